@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 22:35
-** \date Last update: 2020-06-08 15:41
+** \date Last update: 2026-10-18 00:20
 */
 
 #ifndef builders_AbstractBuilder_hpp__
@@ -11,8 +11,10 @@
 
 #include <any>
 #include <memory>
+#include <memory_resource>
 #include <typeinfo>
 #include <typeindex>
+#include <vector>
 
 #include "containers/ContainerFwd.hpp"
 #include "builders/IBuilder.hpp"
@@ -51,6 +53,18 @@ namespace clonixin::builders {
             [[nodiscard]]
             std::any buildVal(Container const &container) const override;
             std::type_index getTypeIndex() const noexcept override;
+            std::vector<utils::type_id_t> getDependencies() const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildShared(Container const &container) const override;
+            [[nodiscard]]
+            std::any wrapShared(std::shared_ptr<void> const &ptr) const override;
+            [[nodiscard]]
+            std::any allocatePtr(Container const &container, std::pmr::memory_resource *resource) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> allocateShared(Container const &container, std::pmr::memory_resource *resource) const override;
+            bool getArguments(std::vector<utils::type_id_t> &args) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const override;
     };
 
     /**
@@ -60,11 +74,12 @@ namespace clonixin::builders {
     ** This function builds an instance of T, store it as a Base in a
     ** std::shared_ptr, then return it as an std::any.
     **
-    ** What it actually does is calling @::new T, and pass each As as a
+    ** What it actually does is calling make_shared<T>, and pass each As as a
     ** parameter, either by requesting an instance to the container, or by
-    ** unwrapping the value, if As is a value holding type. It then store the
-    ** pointer to the newly created instance in a std::shared_ptr<Base>, then
-    ** wrap it in a std::any upon completion.
+    ** unwrapping the value, if As is a value holding type. The instance and
+    ** its control block are thus allocated at once. It then converts the
+    ** pointer to a std::shared_ptr<Base>, and wrap it in a std::any upon
+    ** completion.
     **
     ** \tparam Base Type of the base class. This is the type that will be
     ** requested if and when needed.
@@ -83,7 +98,7 @@ namespace clonixin::builders {
     template <class B, class T, typename... As>
     inline std::any AbstractBuilder<B, T, As...>::buildPtr(Container const &container) const {
         static_assert(std::is_base_of_v<B, T>, "Base is not base class of T.");
-        return std::shared_ptr<B>( ::new T(utils::value::_internals::__value_unwrapper<As>::value(container)...));
+        return std::shared_ptr<B>(std::make_shared<T>(utils::value::_internals::__value_unwrapper<As>::value(container)...));
     }
 
     /**
@@ -142,6 +157,124 @@ namespace clonixin::builders {
     inline std::type_index AbstractBuilder<Base, T, As...>::getTypeIndex() const noexcept {
         return typeid(Base);
     }
+
+    /**
+    ** \brief Get the types requested to the container when building an
+    ** instance.
+    **
+    ** These are the types listed in As, value holding types excepted.
+    **
+    ** \return The dense identifiers of the requested types.
+    */
+    template <class Base, class T, typename... As>
+    inline std::vector<utils::type_id_t> AbstractBuilder<Base, T, As...>::getDependencies() const {
+        std::vector<utils::type_id_t> deps;
+
+        (utils::value::_internals::__value_unwrapper<As>::dependencies(deps), ...);
+        return deps;
+    }
+
+    /**
+    ** \brief Build an instance, as buildPtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, typename... As>
+    inline std::shared_ptr<void> AbstractBuilder<Base, T, As...>::buildShared(Container const &container) const {
+        static_assert(std::is_base_of_v<Base, T>, "Base is not base class of T.");
+        return std::shared_ptr<Base>(std::make_shared<T>(utils::value::_internals::__value_unwrapper<As>::value(container)...));
+    }
+
+    /**
+    ** \brief Wrap a pointer returned by buildShared in a std::any.
+    **
+    ** \param ptr A pointer returned by buildShared.
+    **
+    ** \return This function returns the instance, inside a std::shared_ptr<Base>,
+    ** wrapped in a std::any.
+    */
+    template <class Base, class T, typename... As>
+    inline std::any AbstractBuilder<Base, T, As...>::wrapShared(std::shared_ptr<void> const &ptr) const {
+        return std::static_pointer_cast<Base>(ptr);
+    }
+
+    /**
+    ** \brief Build an instance of type T, as buildPtr does, with its memory
+    ** taken from a given resource.
+    **
+    ** The instance and its control block are allocated together from the
+    ** resource, using allocate_shared<T>.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instance from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<Base>, wrapped in a std::any.
+    */
+    template <class Base, class T, typename... As>
+    inline std::any AbstractBuilder<Base, T, As...>::allocatePtr(Container const &container, std::pmr::memory_resource *resource) const {
+        static_assert(std::is_base_of_v<Base, T>, "Base is not base class of T.");
+        return std::shared_ptr<Base>(std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                    utils::value::_internals::__value_unwrapper<As>::value(container)...));
+    }
+
+    /**
+    ** \brief Build an instance, as allocatePtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instance from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, typename... As>
+    inline std::shared_ptr<void> AbstractBuilder<Base, T, As...>::allocateShared(Container const &container, std::pmr::memory_resource *resource) const {
+        static_assert(std::is_base_of_v<Base, T>, "Base is not base class of T.");
+        return std::shared_ptr<Base>(std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                    utils::value::_internals::__value_unwrapper<As>::value(container)...));
+    }
+
+    /**
+    ** \brief Get the types of the instances buildFrom can be given.
+    **
+    ** These are the types listed in As that are requested to the container
+    ** as shared_ptrs.
+    **
+    ** \param args The list to append the dense identifiers of the types to.
+    **
+    ** \return true.
+    */
+    template <class Base, class T, typename... As>
+    inline bool AbstractBuilder<Base, T, As...>::getArguments(std::vector<utils::type_id_t> &args) const {
+        utils::value::_internals::__plan_arguments<As...>(args);
+        return true;
+    }
+
+    /**
+    ** \brief Build an instance of type T, as buildShared does, from
+    ** instances built beforehand.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param args The instances built beforehand, as listed by getArguments.
+    ** \param resource Memory resource to allocate the instance from, or null
+    ** for the global heap.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, typename... As>
+    inline std::shared_ptr<void> AbstractBuilder<Base, T, As...>::buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const {
+        static_assert(std::is_base_of_v<Base, T>, "Base is not base class of T.");
+        return utils::value::_internals::__plan_build<As...>(container, args, [resource](auto &&...values) {
+            if (resource)
+                return std::shared_ptr<Base>(std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                            std::forward<decltype(values)>(values)...));
+            return std::shared_ptr<Base>(std::make_shared<T>(std::forward<decltype(values)>(values)...));
+        });
+    }
 }
 
 #endif
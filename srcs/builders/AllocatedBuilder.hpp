@@ -0,0 +1,145 @@
+/**
+** \file AllocatedBuilder.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 20:40
+** \date Last update: 2026-10-18 00:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef builders_AllocatedBuilder_hpp__
+#define builders_AllocatedBuilder_hpp__
+
+#include <any>
+#include <memory>
+#include <type_traits>
+
+#include "containers/ContainerFwd.hpp"
+#include "builders/AbstractBuilder.hpp"
+#include "builders/GenericBuilder.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::builders {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Builder AllocatedBuilder inherits everything but allocation
+        ** from.
+        */
+        template <class Base, class T, typename... As>
+        using __allocated_builder_base = std::conditional_t<std::is_same_v<Base, T>,
+              GenericBuilder<T, As...>,
+              AbstractBuilder<Base, T, As...>>;
+    }
+
+    /**
+    ** \brief Automatic builder, allocating instances with a user provided
+    ** allocator.
+    **
+    ** This is the builder used when a type is registered along with an
+    ** allocator. It behaves as GenericBuilder, or AbstractBuilder for
+    ** polymorphic types, except that instances are built with
+    ** allocate_shared<T>: the instance and its control block are allocated at
+    ** once, and released, through a copy of the allocator.
+    **
+    ** Instances built from a memory resource, either while an ArenaScope is
+    ** alive or through the resources of the container, are still taken from
+    ** that resource.
+    **
+    ** \tparam Base Type the instances are returned as.
+    ** \tparam T Type of the instances that'll be built.
+    ** \tparam Alloc An allocator type. It's rebound to T.
+    ** \tparam As... Variadic parameters, containing either a type, or a value
+    ** holding type.
+    */
+    template <class Base, class T, class Alloc, typename... As>
+    class AllocatedBuilder : public _internals::__allocated_builder_base<Base, T, As...> {
+        public:
+            /**
+            ** \brief AllocatedBuilder constructor.
+            **
+            ** \param alloc The allocator instances are allocated with.
+            */
+            explicit AllocatedBuilder(Alloc const &alloc) : _alloc(alloc) {}
+
+            /**
+            ** \brief AllocatedBuilder destructor.
+            */
+            virtual ~AllocatedBuilder() {}
+
+            [[nodiscard]]
+            std::any buildPtr(Container const &container) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildShared(Container const &container) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const override;
+
+        private:
+            using _allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+
+            std::shared_ptr<Base> _allocate(Container const &container) const;
+
+            _allocator _alloc;
+    };
+
+    /**
+    ** \internal
+    ** \brief Build an instance of T, with its control block, using the
+    ** allocator.
+    */
+    template <class Base, class T, class Alloc, typename... As>
+    inline std::shared_ptr<Base> AllocatedBuilder<Base, T, Alloc, As...>::_allocate(Container const &container) const {
+        static_assert(std::is_base_of_v<Base, T> || std::is_same_v<Base, T>, "Base is not base class of T.");
+        return std::allocate_shared<T>(_alloc, utils::value::_internals::__value_unwrapper<As>::value(container)...);
+    }
+
+    /**
+    ** \brief Build an instance of type T, using As types, and return it as a
+    ** Base.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<Base>, wrapped in a std::any.
+    */
+    template <class Base, class T, class Alloc, typename... As>
+    inline std::any AllocatedBuilder<Base, T, Alloc, As...>::buildPtr(Container const &container) const {
+        return _allocate(container);
+    }
+
+    /**
+    ** \brief Build an instance, as buildPtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, class Alloc, typename... As>
+    inline std::shared_ptr<void> AllocatedBuilder<Base, T, Alloc, As...>::buildShared(Container const &container) const {
+        return _allocate(container);
+    }
+
+    /**
+    ** \brief Build an instance, as buildShared does, from instances built
+    ** beforehand.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param args The instances built beforehand, as listed by getArguments.
+    ** \param resource Memory resource to allocate the instance from, or null
+    ** to use the allocator.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, class Alloc, typename... As>
+    inline std::shared_ptr<void> AllocatedBuilder<Base, T, Alloc, As...>::buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const {
+        if (resource)
+            return _internals::__allocated_builder_base<Base, T, As...>::buildFrom(container, args, resource);
+        return utils::value::_internals::__plan_build<As...>(container, args, [this](auto &&...values) {
+            return std::shared_ptr<Base>(std::allocate_shared<T>(_alloc, std::forward<decltype(values)>(values)...));
+        });
+    }
+}
+
+#endif
@@ -0,0 +1,403 @@
+/**
+** \file FlatBuilder.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 23:55
+** \date Last update: 2026-10-18 11:00
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef builders_FlatBuilder_hpp__
+#define builders_FlatBuilder_hpp__
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "containers/ArenaScope.hpp"
+#include "containers/ContainerFwd.hpp"
+#include "builders/AbstractBuilder.hpp"
+#include "builders/GenericBuilder.hpp"
+#include "builders/ITypedBuilder.hpp"
+#include "type_desc/Lifetime.hpp"
+#include "type_desc/TypeDescriptors.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::builders {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief AbstractBuilder, able to build T by value as GenericBuilder
+        ** is, so that FlatBuilder always overrides ITypedBuilder::buildValue.
+        */
+        template <class Base, class T, typename... As>
+        class __flat_abstract_builder : public AbstractBuilder<Base, T, As...>, public ITypedBuilder<T> {};
+
+        /**
+        ** \internal
+        ** \brief Builder FlatBuilder inherits everything but construction
+        ** from.
+        */
+        template <class Base, class T, typename... As>
+        using __flat_builder_base = std::conditional_t<std::is_same_v<Base, T>,
+              GenericBuilder<T, As...>,
+              __flat_abstract_builder<Base, T, As...>>;
+
+        /**
+        ** \internal
+        ** \brief Registration of A among Regs, or void if there is none.
+        */
+        template <class A, class... Regs>
+        struct __find_registration {
+            using type = void;
+        };
+
+        /**
+        ** \internal
+        ** \brief Registration of A among Regs, or void if there is none.
+        */
+        template <class A, class Reg, class... Regs>
+        struct __find_registration<A, Reg, Regs...> {
+            using type = std::conditional_t<std::is_same_v<A, typename Reg::regs>,
+                  Reg,
+                  typename __find_registration<A, Regs...>::type>;
+        };
+
+        /**
+        ** \internal
+        ** \brief Whether Reg is a transient registration.
+        */
+        template <class Reg>
+        struct __is_transient : std::bool_constant<Reg::lifetime == type_desc::Lifetime::Transient> {};
+
+        /**
+        ** \internal
+        ** \brief Whether Reg is a transient registration. No registration is
+        ** not.
+        */
+        template <>
+        struct __is_transient<void> : std::false_type {};
+
+        /**
+        ** \internal
+        ** \brief Whether a request for A can be replaced by building its
+        ** registration in place.
+        **
+        ** That's the case if A is registered exactly once in Regs, as a
+        ** transient: the container would then build a new instance from that
+        ** very registration.
+        */
+        template <class A, class Regs>
+        struct __flat_registration;
+
+        /**
+        ** \internal
+        ** \brief Whether a request for A can be replaced by building its
+        ** registration in place.
+        */
+        template <class A, class... Regs>
+        struct __flat_registration<A, type_traits::type_list<Regs...>> {
+            using type = typename __find_registration<A, Regs...>::type;
+
+            static constexpr bool value = (0 + ... + int(std::is_same_v<A, typename Regs::regs>)) == 1
+                && __is_transient<type>::value;
+        };
+
+        /**
+        ** \internal
+        ** \brief Constructor argument of a flattened builder.
+        **
+        ** This fallback version requests the argument to the container, as
+        ** __value_unwrapper does.
+        **
+        ** \tparam A The constructor argument, as given to addType.
+        ** \tparam Regs Every registration of the set.
+        */
+        template <typename A, class Regs, typename = std::void_t<>>
+        struct __flat_unwrapper {
+            using type = typename utils::value::_internals::__value_unwrapper<A>::type;
+
+            static constexpr bool inlined = false;
+
+            template <class C>
+            static type value(C const &c, [[maybe_unused]] std::pmr::memory_resource *resource) {
+                return utils::value::_internals::__value_unwrapper<A>::value(c);
+            }
+        };
+
+        /**
+        ** \internal
+        ** \brief Construction of the registration Reg, with every argument it
+        ** can build in place built in place.
+        */
+        template <class Reg, class Regs, class Args = typename Reg::args>
+        struct __flat_node;
+
+        /**
+        ** \internal
+        ** \brief Construction of the registration Reg, with every argument it
+        ** can build in place built in place.
+        */
+        template <class Reg, class Regs, typename... As>
+        struct __flat_node<Reg, Regs, type_traits::type_list<As...>> {
+            using T = typename Reg::type;
+
+            /**
+            ** \brief Build a new instance, from resource if any, as
+            ** GenericBuilder::allocateShared would.
+            */
+            template <class C>
+            static std::shared_ptr<T> shared(C const &c, std::pmr::memory_resource *resource) {
+                if (resource)
+                    return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                            __flat_unwrapper<As, Regs>::value(c, resource)...);
+                return std::make_shared<T>(__flat_unwrapper<As, Regs>::value(c, resource)...);
+            }
+
+            /**
+            ** \brief Build a new instance, as GenericBuilder::buildValue
+            ** would.
+            */
+            template <class C>
+            static T value(C const &c, std::pmr::memory_resource *resource) {
+                return T(__flat_unwrapper<As, Regs>::value(c, resource)...);
+            }
+        };
+
+        /**
+        ** \internal
+        ** \brief Constructor argument of a flattened builder.
+        **
+        ** This specialisation is used for instances requested to the
+        ** container, when their registration is a transient of the same set:
+        ** the instance is built in place, instead of being requested.
+        */
+        template <typename A, class Regs>
+        struct __flat_unwrapper<A, Regs, std::enable_if_t<
+            std::is_same_v<typename utils::value::_internals::__value_unwrapper<A>::type, std::shared_ptr<A>> &&
+            __flat_registration<A, Regs>::value
+        >> {
+            using type = std::shared_ptr<A>;
+
+            static constexpr bool inlined = true;
+
+            template <class C>
+            static type value(C const &c, std::pmr::memory_resource *resource) {
+                return __flat_node<typename __flat_registration<A, Regs>::type, Regs>::shared(c, resource);
+            }
+        };
+
+        /**
+        ** \internal
+        ** \brief Constructor argument of a flattened builder.
+        **
+        ** This specialisation is used for values requested to the container,
+        ** when their registration is a non polymorphic transient of the same
+        ** set: the value is constructed directly into the parameter. Values
+        ** of polymorphic registrations cannot be built, and are left to the
+        ** container to report.
+        */
+        template <typename A, class Regs>
+        struct __flat_unwrapper<A, Regs, std::enable_if_t<
+            std::is_rvalue_reference_v<A> &&
+            __flat_registration<std::remove_reference_t<A>, Regs>::value &&
+            std::is_same_v<
+                typename __flat_registration<std::remove_reference_t<A>, Regs>::type::type,
+                std::remove_reference_t<A>>
+        >> {
+            using type = std::remove_reference_t<A>;
+
+            static constexpr bool inlined = true;
+
+            template <class C>
+            static type value(C const &c, std::pmr::memory_resource *resource) {
+                return __flat_node<typename __flat_registration<type, Regs>::type, Regs>::value(c, resource);
+            }
+        };
+
+        /**
+        ** \internal
+        ** \brief Whether any of As would be built in place by a flattened
+        ** builder.
+        */
+        template <class Regs, typename... As>
+        constexpr bool __flattens = (false || ... || __flat_unwrapper<As, Regs>::inlined);
+    }
+
+    /**
+    ** \brief Automatic builder, building the transient dependencies it knows
+    ** of in place.
+    **
+    ** This is the builder used for transients registered through
+    ** Container::addTypes, whose whole registration set is known at compile
+    ** time. Each argument that the container would build as a new transient
+    ** of the set is constructed right there instead, along with its own
+    ** arguments: a tree of transients is built by a single constructor
+    ** expression, without any virtual call, std::any, nor lookup. Arguments
+    ** with another lifetime, or which are not part of the set, are still
+    ** requested to the container.
+    **
+    ** Instances built in place are allocated as the container would allocate
+    ** them, from the memory resource the top-level instance is allocated
+    ** from, if any.
+    **
+    ** \tparam Base Type the instances are returned as.
+    ** \tparam T Type of the instances that'll be built.
+    ** \tparam Regs A type_list of every registration of the set.
+    ** \tparam As... Variadic parameters, containing either a type, or a value
+    ** holding type.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    class FlatBuilder : public _internals::__flat_builder_base<Base, T, As...> {
+        public:
+            /**
+            ** \brief FlatBuilder destructor.
+            */
+            virtual ~FlatBuilder() {}
+
+            [[nodiscard]]
+            std::any buildPtr(Container const &container) const override;
+            [[nodiscard]]
+            std::any buildVal(Container const &container) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildShared(Container const &container) const override;
+            [[nodiscard]]
+            std::any allocatePtr(Container const &container, std::pmr::memory_resource *resource) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> allocateShared(Container const &container, std::pmr::memory_resource *resource) const override;
+            T buildValue(Container const &container) const override;
+            bool getArguments(std::vector<utils::type_id_t> &args) const override;
+
+        private:
+            using _node = _internals::__flat_node<type_desc::With<type_desc::Transient<Base, T>, As...>, Regs>;
+
+            template <class C>
+            static std::pmr::memory_resource *_resource(C const &container);
+    };
+
+    /**
+    ** \internal
+    ** \brief Resource the container would allocate the transients requested
+    ** by a constructor from: the arena of the calling thread, or else the
+    ** transient resource of the container.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    template <class C>
+    inline std::pmr::memory_resource *FlatBuilder<Base, T, Regs, As...>::_resource(C const &container) {
+        if (auto *arena = clonixin::_internals::currentArena())
+            return arena;
+        return container.getTransientResource();
+    }
+
+    /**
+    ** \brief Build an instance of type T, and return it as a Base.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<Base>, wrapped in a std::any.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline std::any FlatBuilder<Base, T, Regs, As...>::buildPtr(Container const &container) const {
+        return std::shared_ptr<Base>(_node::shared(container, nullptr));
+    }
+
+    /**
+    ** \brief Build an instance of type T, in a std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \throw exceptions::BuilderException<exceptions::BuilderError::AbstractRvalue>
+    ** Thrown if Base is not T.
+    ** \throw exceptions::BuilderException<exceptions::BuilderError::RvalueUnsupported>
+    ** Thrown if T cannot be moved.
+    **
+    ** \return This function returns a newly created instance,
+    ** wrapped in a std::any.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline std::any FlatBuilder<Base, T, Regs, As...>::buildVal(Container const &container) const {
+        if constexpr (std::is_same_v<Base, T> && std::is_move_constructible_v<T>)
+            return std::any(_node::value(container, _resource(container)));
+        else
+            return _internals::__flat_builder_base<Base, T, As...>::buildVal(container);
+    }
+
+    /**
+    ** \brief Build an instance, as buildPtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline std::shared_ptr<void> FlatBuilder<Base, T, Regs, As...>::buildShared(Container const &container) const {
+        return std::shared_ptr<Base>(_node::shared(container, nullptr));
+    }
+
+    /**
+    ** \brief Build an instance of type T, as buildPtr does, with its memory
+    ** and the memory of the instances built in place taken from a given
+    ** resource.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instances from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<Base>, wrapped in a std::any.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline std::any FlatBuilder<Base, T, Regs, As...>::allocatePtr(Container const &container, std::pmr::memory_resource *resource) const {
+        return std::shared_ptr<Base>(_node::shared(container, resource));
+    }
+
+    /**
+    ** \brief Build an instance, as allocatePtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instances from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline std::shared_ptr<void> FlatBuilder<Base, T, Regs, As...>::allocateShared(Container const &container, std::pmr::memory_resource *resource) const {
+        return std::shared_ptr<Base>(_node::shared(container, resource));
+    }
+
+    /**
+    ** \brief Build an instance of type T, and return it by value.
+    **
+    ** This overrides ITypedBuilder::buildValue: the instance, and every
+    ** value built in place for it, are constructed directly where the
+    ** caller wants them.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline T FlatBuilder<Base, T, Regs, As...>::buildValue(Container const &container) const {
+        return _node::value(container, _resource(container));
+    }
+
+    /**
+    ** \brief Refuse to be built from instances built beforehand.
+    **
+    ** A flattened builder already builds its transient dependencies in
+    ** place, so resolution plans leave it to the container.
+    **
+    ** \return false.
+    */
+    template <class Base, class T, class Regs, typename... As>
+    inline bool FlatBuilder<Base, T, Regs, As...>::getArguments([[maybe_unused]] std::vector<utils::type_id_t> &args) const {
+        return false;
+    }
+}
+
+#endif
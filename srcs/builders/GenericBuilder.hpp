@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 22:21
-** \date Last update: 2020-05-26 12:56
+** \date Last update: 2026-10-18 00:20
 ** \copyright GNU Lesser Public Licence v3
 */
 
@@ -12,11 +12,14 @@
 
 #include <any>
 #include <memory>
+#include <memory_resource>
 #include <typeinfo>
 #include <typeindex>
+#include <vector>
 
 #include "containers/ContainerFwd.hpp"
 #include "builders/IBuilder.hpp"
+#include "builders/ITypedBuilder.hpp"
 #include "exceptions/BuilderException.hpp"
 #include "utils/ValueWrapper.hpp"
 
@@ -32,7 +35,7 @@ namespace clonixin::builders {
     ** holding type.
     */
     template <class T, typename... As>
-    class GenericBuilder : public IBuilder {
+    class GenericBuilder : public IBuilder, public ITypedBuilder<T> {
         public:
             /**
             ** \brief GenericBuilder destructor.
@@ -44,6 +47,19 @@ namespace clonixin::builders {
             [[nodiscard]]
             std::any buildVal(Container const &container) const override;
             std::type_index getTypeIndex() const noexcept override;
+            std::vector<utils::type_id_t> getDependencies() const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildShared(Container const &container) const override;
+            [[nodiscard]]
+            std::any wrapShared(std::shared_ptr<void> const &ptr) const override;
+            [[nodiscard]]
+            std::any allocatePtr(Container const &container, std::pmr::memory_resource *resource) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> allocateShared(Container const &container, std::pmr::memory_resource *resource) const override;
+            T buildValue(Container const &container) const override;
+            bool getArguments(std::vector<utils::type_id_t> &args) const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const override;
     };
 
     /**
@@ -162,6 +178,136 @@ namespace clonixin::builders {
     inline std::type_index GenericBuilder<T, As...>::getTypeIndex() const noexcept {
         return typeid(T);
     }
+
+    /**
+    ** \brief Get the types requested to the container when building an
+    ** instance.
+    **
+    ** These are the types listed in As, value holding types excepted.
+    **
+    ** \return The dense identifiers of the requested types.
+    */
+    template <class T, typename... As>
+    inline std::vector<utils::type_id_t> GenericBuilder<T, As...>::getDependencies() const {
+        std::vector<utils::type_id_t> deps;
+
+        (utils::value::_internals::__value_unwrapper<As>::dependencies(deps), ...);
+        return deps;
+    }
+
+    /**
+    ** \brief Build an instance, as buildPtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void>.
+    */
+    template <class T, typename... As>
+    inline std::shared_ptr<void> GenericBuilder<T, As...>::buildShared(Container const &container) const {
+        return std::make_shared<T>(utils::value::_internals::__value_unwrapper<As>::value(container)...);
+    }
+
+    /**
+    ** \brief Wrap a pointer returned by buildShared in a std::any.
+    **
+    ** \param ptr A pointer returned by buildShared.
+    **
+    ** \return This function returns the instance, inside a std::shared_ptr<T>,
+    ** wrapped in a std::any.
+    */
+    template <class T, typename... As>
+    inline std::any GenericBuilder<T, As...>::wrapShared(std::shared_ptr<void> const &ptr) const {
+        return std::static_pointer_cast<T>(ptr);
+    }
+
+    /**
+    ** \brief Build an instance of type T, as buildPtr does, with its memory
+    ** taken from a given resource.
+    **
+    ** The instance and its control block are allocated together from the
+    ** resource, using allocate_shared<T>.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instance from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<T>, wrapped in a std::any.
+    */
+    template <class T, typename... As>
+    inline std::any GenericBuilder<T, As...>::allocatePtr(Container const &container, std::pmr::memory_resource *resource) const {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                utils::value::_internals::__value_unwrapper<As>::value(container)...);
+    }
+
+    /**
+    ** \brief Build an instance, as allocatePtr does, without the std::any.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param resource Memory resource to allocate the instance from.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void>.
+    */
+    template <class T, typename... As>
+    inline std::shared_ptr<void> GenericBuilder<T, As...>::allocateShared(Container const &container, std::pmr::memory_resource *resource) const {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource),
+                utils::value::_internals::__value_unwrapper<As>::value(container)...);
+    }
+
+    /**
+    ** \brief Build an instance of type T, using As types, and return it by
+    ** value.
+    **
+    ** The constructor is called in the return statement, so the instance is
+    ** built directly where the caller wants it, without std::any nor any
+    ** copy or move.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns a newly created instance.
+    */
+    template <class T, typename... As>
+    inline T GenericBuilder<T, As...>::buildValue(Container const &container) const {
+        return T(utils::value::_internals::__value_unwrapper<As>::value(container)...);
+    }
+
+    /**
+    ** \brief Get the types of the instances buildFrom can be given.
+    **
+    ** These are the types listed in As that are requested to the container
+    ** as shared_ptrs.
+    **
+    ** \param args The list to append the dense identifiers of the types to.
+    **
+    ** \return true.
+    */
+    template <class T, typename... As>
+    inline bool GenericBuilder<T, As...>::getArguments(std::vector<utils::type_id_t> &args) const {
+        utils::value::_internals::__plan_arguments<As...>(args);
+        return true;
+    }
+
+    /**
+    ** \brief Build an instance of type T, as buildShared does, from
+    ** instances built beforehand.
+    **
+    ** \param container Clonixin IoC container.
+    ** \param args The instances built beforehand, as listed by getArguments.
+    ** \param resource Memory resource to allocate the instance from, or null
+    ** for the global heap.
+    **
+    ** \return This function returns a newly created instance, inside a
+    ** std::shared_ptr<void>.
+    */
+    template <class T, typename... As>
+    inline std::shared_ptr<void> GenericBuilder<T, As...>::buildFrom(Container const &container, std::shared_ptr<void> const *args, std::pmr::memory_resource *resource) const {
+        return utils::value::_internals::__plan_build<As...>(container, args, [resource](auto &&...values) {
+            if (resource)
+                return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(resource), std::forward<decltype(values)>(values)...);
+            return std::make_shared<T>(std::forward<decltype(values)>(values)...);
+        });
+    }
 }
 
 #endif
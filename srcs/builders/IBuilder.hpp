@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 16:05
-** \date Last update: 2020-06-08 21:47
+** \date Last update: 2026-10-18 00:20
 ** \copyright GNU Lesser Public Licence v3
 */
 
@@ -11,9 +11,13 @@
 #define builders_IBuilder_hpp__
 
 #include <any>
+#include <memory>
+#include <memory_resource>
 #include <typeindex>
+#include <vector>
 
 #include "containers/ContainerFwd.hpp"
+#include "utils/TypeId.hpp"
 
 /**
 ** \brief Clonixin default Builders namespace
@@ -73,6 +77,124 @@ namespace clonixin::builders {
             ** \return The std::type_index of the instance that'll be built.
             */
             virtual std::type_index getTypeIndex() const noexcept = 0;
+
+            /**
+            ** \brief Get the types requested to the container when building
+            ** an instance.
+            **
+            ** This is used by Container::warmUp to find in which order
+            ** singletons can be built. Builders that cannot know their
+            ** dependencies in advance return an empty list, the default.
+            **
+            ** \return The dense identifiers of the requested types.
+            */
+            virtual std::vector<utils::type_id_t> getDependencies() const { return {}; }
+
+            /**
+            ** \brief Build an instance of a class, and return it as a
+            ** shared_ptr<void>.
+            **
+            ** This is used by lifetimes that need to keep an instance without
+            ** knowing its type, such as Cached. The pointer must be turned back
+            ** into what buildPtr would return by wrapShared.
+            **
+            ** Builders not supporting it return an empty pointer, the default.
+            **
+            ** \param container IoC container to which the other dependencies
+            ** are requested.
+            **
+            ** \return The instance, or an empty pointer.
+            */
+            [[nodiscard]]
+            virtual std::shared_ptr<void> buildShared([[maybe_unused]] Container const &container) const { return nullptr; }
+
+            /**
+            ** \brief Wrap a pointer returned by buildShared in a std::any, as
+            ** buildPtr would.
+            **
+            ** \param ptr A pointer returned by buildShared.
+            **
+            ** \return This function returns a std::any, wrapping a shared_ptr.
+            */
+            [[nodiscard]]
+            virtual std::any wrapShared([[maybe_unused]] std::shared_ptr<void> const &ptr) const { return {}; }
+
+            /**
+            ** \brief Build an instance of a class, as buildPtr does, with its
+            ** memory taken from a given resource.
+            **
+            ** This is used for transients built inside an ArenaScope, and for
+            ** instances built from the memory resources of the container.
+            ** Both the instance and its shared_ptr control block should come
+            ** from the resource.
+            **
+            ** Builders not supporting it build the instance with buildPtr,
+            ** the default.
+            **
+            ** \param container IoC container to which the other dependencies
+            ** are requested.
+            ** \param resource Memory resource to allocate the instance from.
+            **
+            ** \return This function returns a std::any, wrapping a shared_ptr.
+            */
+            [[nodiscard]]
+            virtual std::any allocatePtr(Container const &container, [[maybe_unused]] std::pmr::memory_resource *resource) const {
+                return buildPtr(container);
+            }
+
+            /**
+            ** \brief Build an instance of a class, as buildShared does, with
+            ** its memory taken from a given resource.
+            **
+            ** Builders not supporting it build the instance with buildShared,
+            ** the default.
+            **
+            ** \param container IoC container to which the other dependencies
+            ** are requested.
+            ** \param resource Memory resource to allocate the instance from.
+            **
+            ** \return The instance, or an empty pointer.
+            */
+            [[nodiscard]]
+            virtual std::shared_ptr<void> allocateShared(Container const &container, [[maybe_unused]] std::pmr::memory_resource *resource) const {
+                return buildShared(container);
+            }
+
+            /**
+            ** \brief Get the types of the instances buildFrom can be given,
+            ** in order.
+            **
+            ** This is used by Container::compilePlan, to build these
+            ** instances beforehand. Builders not supporting buildFrom return
+            ** false, the default, and are left to the container.
+            **
+            ** \param args The list to append the dense identifiers of the
+            ** types to.
+            **
+            ** \return Whether the builder supports buildFrom.
+            */
+            virtual bool getArguments([[maybe_unused]] std::vector<utils::type_id_t> &args) const { return false; }
+
+            /**
+            ** \brief Build an instance of a class, as buildShared or
+            ** allocateShared do, from instances built beforehand.
+            **
+            ** \param container IoC container to which the other dependencies
+            ** are requested.
+            ** \param args One instance per type listed by getArguments, as a
+            ** shared_ptr<void> to that type. Empty instances are requested to
+            ** the container instead.
+            ** \param resource Memory resource to allocate the instance from,
+            ** or null for the default.
+            **
+            ** \return The instance, or an empty pointer.
+            */
+            [[nodiscard]]
+            virtual std::shared_ptr<void> buildFrom([[maybe_unused]] Container const &container,
+                    [[maybe_unused]] std::shared_ptr<void> const *args,
+                    [[maybe_unused]] std::pmr::memory_resource *resource) const {
+                return nullptr;
+            }
     };
 }
 
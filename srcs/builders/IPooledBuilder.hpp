@@ -0,0 +1,61 @@
+/**
+** \file IPooledBuilder.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 17:40
+** \date Last update: 2026-10-17 17:40
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef builders_IPooledBuilder_hpp__
+#define builders_IPooledBuilder_hpp__
+
+#include <cstddef>
+
+namespace clonixin::builders {
+    /**
+    ** \brief Usage statistics of an object pool.
+    */
+    struct PoolStats {
+        /**
+        ** \brief Number of requests served with a recycled instance.
+        */
+        std::size_t hits;
+
+        /**
+        ** \brief Number of requests that had to build a new instance.
+        */
+        std::size_t misses;
+
+        /**
+        ** \brief Number of instances currently waiting to be reused.
+        */
+        std::size_t idle;
+
+        /**
+        ** \brief Maximum number of idle instances kept.
+        */
+        std::size_t capacity;
+    };
+
+    /**
+    ** \brief Pooled builder interface.
+    **
+    ** Implemented by builders recycling the instances they build, so that
+    ** Container::getPoolStats can report on their pool.
+    */
+    class IPooledBuilder {
+        public:
+            /**
+            ** \brief IPooledBuilder destructor.
+            */
+            virtual ~IPooledBuilder() {}
+
+            /**
+            ** \brief Get the usage statistics of the pool.
+            */
+            virtual PoolStats getPoolStats() const noexcept = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,48 @@
+/**
+** \file ITypedBuilder.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 20:10
+** \date Last update: 2026-10-17 20:10
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef builders_ITypedBuilder_hpp__
+#define builders_ITypedBuilder_hpp__
+
+#include "containers/ContainerFwd.hpp"
+
+namespace clonixin::builders {
+    /**
+    ** \brief Typed builder interface.
+    **
+    ** Implemented by builders able to return the instance they build by
+    ** value. This is what Container::resolve uses, instead of
+    ** IBuilder::buildVal and its std::any.
+    **
+    ** \tparam T Type of the instances built.
+    */
+    template <class T>
+    class ITypedBuilder {
+        public:
+            /**
+            ** \brief ITypedBuilder destructor.
+            */
+            virtual ~ITypedBuilder() {}
+
+            /**
+            ** \brief Build an instance of T, and return it by value.
+            **
+            ** The instance is built directly in the returned value: T does
+            ** not need to be copyable nor movable.
+            **
+            ** \param container IoC container to which the other dependencies
+            ** are requested.
+            **
+            ** \return The newly built instance.
+            */
+            virtual T buildValue(Container const &container) const = 0;
+    };
+}
+
+#endif
@@ -0,0 +1,442 @@
+/**
+** \file PooledBuilder.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 17:40
+** \date Last update: 2026-10-18 11:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef builders_PooledBuilder_hpp__
+#define builders_PooledBuilder_hpp__
+
+#include <algorithm>
+#include <any>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+#include <typeindex>
+#include <vector>
+
+#include "containers/ArenaScope.hpp"
+#include "containers/ContainerFwd.hpp"
+#include "containers/Scope.hpp"
+#include "builders/IBuilder.hpp"
+#include "builders/IPooledBuilder.hpp"
+#include "exceptions/BuilderException.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::builders {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Whether T has a reset() member function, called before an
+        ** instance is put back into its pool.
+        */
+        template <class T, typename = std::void_t<>>
+        struct __has_reset : std::false_type {};
+
+        /**
+        ** \internal
+        ** \brief Whether T has a reset() member function, called before an
+        ** instance is put back into its pool.
+        */
+        template <class T>
+        struct __has_reset<T, std::void_t<decltype(std::declval<T &>().reset())>> : std::true_type {};
+
+        /**
+        ** \internal
+        ** \brief Shared state of an object pool.
+        **
+        ** Idle instances are either kept in the shared list, or in the local
+        ** cache of the thread that released them. idle counts both, and
+        ** bounds them to capacity.
+        **
+        ** Once its builder is destroyed, the pool is closed: idle instances
+        ** are destroyed, and released ones are no longer taken back.
+        */
+        template <class T>
+        struct PoolState {
+            explicit PoolState(std::size_t cap) : capacity(cap) {}
+            PoolState(PoolState const &) = delete;
+            PoolState &operator=(PoolState const &) = delete;
+            ~PoolState() {
+                for (T *obj: shared)
+                    delete obj;
+            }
+
+            /**
+            ** \brief Close the pool, and destroy the instances of the shared
+            ** list.
+            **
+            ** They are destroyed outside of the lock, as their destructors
+            ** may release pooled instances too.
+            */
+            void close() {
+                std::vector<T *> dropped;
+
+                {
+                    std::lock_guard lock(mutex);
+                    closed.store(true, std::memory_order_release);
+                    dropped.swap(shared);
+                }
+                idle.fetch_sub(dropped.size(), std::memory_order_relaxed);
+                for (T *obj: dropped)
+                    delete obj;
+            }
+
+            std::size_t const capacity;
+
+            std::mutex mutex;
+            std::vector<T *> shared;
+            std::atomic<bool> closed = false;
+
+            std::atomic<std::size_t> idle = 0;
+            std::atomic<std::size_t> hits = 0;
+            std::atomic<std::size_t> misses = 0;
+        };
+
+        /**
+        ** \internal
+        ** \brief Idle instances kept by a thread, to be reused without
+        ** locking.
+        **
+        ** A thread caches instances of a single pool per type. The cache is
+        ** tagged with the pool it belongs to, and handed back to it when the
+        ** thread switches to another pool, or exits. Instances of a closed
+        ** pool are destroyed instead: by the thread destroying the builder,
+        ** or by other threads the next time they use a pool of T.
+        */
+        template <class T>
+        struct PoolLocalCache {
+            PoolLocalCache() = default;
+            PoolLocalCache(PoolLocalCache const &) = delete;
+            PoolLocalCache &operator=(PoolLocalCache const &) = delete;
+            ~PoolLocalCache() { flush(); }
+
+            /**
+            ** \brief Give every cached instance back to the shared list of
+            ** their pool, or destroy them if the pool is closed.
+            */
+            void flush() {
+                if (!pool)
+                    return;
+
+                std::vector<T *> dropped;
+
+                {
+                    std::lock_guard lock(pool->mutex);
+
+                    if (pool->closed.load(std::memory_order_relaxed))
+                        dropped.swap(items);
+                    else
+                        pool->shared.insert(pool->shared.end(), items.begin(), items.end());
+                    items.clear();
+                }
+                pool->idle.fetch_sub(dropped.size(), std::memory_order_relaxed);
+                for (T *obj: dropped)
+                    delete obj;
+            }
+
+            /**
+            ** \brief Destroy the cached instances, and forget their pool, if
+            ** it is closed.
+            */
+            void prune() {
+                if (!pool || !pool->closed.load(std::memory_order_acquire))
+                    return;
+
+                flush();
+                pool.reset();
+            }
+
+            std::shared_ptr<PoolState<T>> pool;
+            std::vector<T *> items;
+        };
+
+        /**
+        ** \internal
+        ** \brief The calling thread's cache, for pools of T.
+        */
+        template <class T>
+        inline PoolLocalCache<T> &poolLocalCache() {
+            static thread_local PoolLocalCache<T> cache;
+            return cache;
+        }
+
+        /**
+        ** \internal
+        ** \brief Deleter of pooled instances, putting them back into their
+        ** pool.
+        */
+        template <class T>
+        struct PoolDeleter {
+            std::shared_ptr<PoolState<T>> pool;
+
+            void operator()(T *obj) const noexcept;
+        };
+
+        /**
+        ** \internal
+        ** \brief Put an instance back into its pool.
+        **
+        ** The instance is reset first, if T has a reset() member function. It
+        ** is destroyed instead if the pool is full or closed, or if resetting
+        ** it threw. Otherwise it goes into the local cache of the calling
+        ** thread, or into the shared list if the cache is full or used by
+        ** another pool.
+        */
+        template <class T>
+        inline void PoolDeleter<T>::operator()(T *obj) const noexcept {
+            auto &cache = poolLocalCache<T>();
+
+            cache.prune();
+            if (pool->closed.load(std::memory_order_acquire)) {
+                delete obj;
+                return;
+            }
+
+            if constexpr (__has_reset<T>::value) {
+                try {
+                    obj->reset();
+                } catch (...) {
+                    delete obj;
+                    return;
+                }
+            }
+
+            if (pool->idle.fetch_add(1, std::memory_order_relaxed) >= pool->capacity) {
+                pool->idle.fetch_sub(1, std::memory_order_relaxed);
+                delete obj;
+                return;
+            }
+
+            std::size_t local_capacity = std::max<std::size_t>(1, pool->capacity / 4);
+
+            try {
+                if (cache.pool != pool && cache.items.empty())
+                    cache.pool = pool;
+                if (cache.pool == pool && cache.items.size() < local_capacity) {
+                    cache.items.push_back(obj);
+                    return;
+                }
+
+                std::unique_lock lock(pool->mutex);
+
+                if (!pool->closed.load(std::memory_order_relaxed)) {
+                    pool->shared.push_back(obj);
+                    return;
+                }
+                lock.unlock();
+                pool->idle.fetch_sub(1, std::memory_order_relaxed);
+                delete obj;
+            } catch (...) {
+                pool->idle.fetch_sub(1, std::memory_order_relaxed);
+                delete obj;
+            }
+        }
+    }
+
+    /**
+    ** \brief Builder recycling the instances it builds.
+    **
+    ** This is the builder used for types registered with the Pooled lifetime.
+    ** Instances are handed out in a shared_ptr whose deleter puts them back
+    ** into the pool, instead of destroying them, and later requests reuse
+    ** them. Dependencies are only requested when a new instance is built.
+    **
+    ** If T has a reset() member function, it's called on each instance before
+    ** it's put back into the pool.
+    **
+    ** At most N idle instances are kept, spread between a shared list and
+    ** small per-thread caches, so that a thread releasing and requesting
+    ** instances doesn't have to lock.
+    **
+    ** \tparam Base Type the instances are returned as.
+    ** \tparam T Type of the instances that'll be built.
+    ** \tparam N Maximum number of idle instances kept.
+    ** \tparam As... Variadic parameters, containing either a type, or a value
+    ** holding type.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    class PooledBuilder : public IBuilder, public IPooledBuilder {
+        public:
+            PooledBuilder() = default;
+            PooledBuilder(PooledBuilder const &) = delete;
+            PooledBuilder &operator=(PooledBuilder const &) = delete;
+            virtual ~PooledBuilder();
+
+            [[nodiscard]]
+            std::any buildPtr(Container const &container) const override;
+            [[nodiscard]]
+            std::any buildVal(Container const &container) const override;
+            std::type_index getTypeIndex() const noexcept override;
+            std::vector<utils::type_id_t> getDependencies() const override;
+            [[nodiscard]]
+            std::shared_ptr<void> buildShared(Container const &container) const override;
+            [[nodiscard]]
+            std::any wrapShared(std::shared_ptr<void> const &ptr) const override;
+            PoolStats getPoolStats() const noexcept override;
+
+        private:
+            std::shared_ptr<Base> _acquire(Container const &container) const;
+
+            std::shared_ptr<_internals::PoolState<T>> _pool = std::make_shared<_internals::PoolState<T>>(N);
+    };
+
+    /**
+    ** \brief PooledBuilder destructor.
+    **
+    ** The pool is closed: idle instances of the shared list and of the
+    ** calling thread's cache are destroyed. Instances still in use keep the
+    ** pool state alive, and are destroyed when released.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline PooledBuilder<Base, T, N, As...>::~PooledBuilder() {
+        _pool->close();
+        _internals::poolLocalCache<T>().prune();
+    }
+
+    /**
+    ** \internal
+    ** \brief Get an instance from the pool, or build a new one.
+    **
+    ** The local cache of the calling thread is tried first, then the shared
+    ** list of the pool. New instances outlive any arena and scope, so those
+    ** bound to the calling thread are suspended while building them.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::shared_ptr<Base> PooledBuilder<Base, T, N, As...>::_acquire(Container const &container) const {
+        static_assert(std::is_base_of_v<Base, T> || std::is_same_v<Base, T>, "Base is not base class of T.");
+        auto &cache = _internals::poolLocalCache<T>();
+        T *obj = nullptr;
+
+        cache.prune();
+        if (cache.pool == _pool && !cache.items.empty()) {
+            obj = cache.items.back();
+            cache.items.pop_back();
+        } else {
+            std::lock_guard lock(_pool->mutex);
+
+            if (!_pool->shared.empty()) {
+                obj = _pool->shared.back();
+                _pool->shared.pop_back();
+            }
+        }
+
+        if (obj) {
+            _pool->idle.fetch_sub(1, std::memory_order_relaxed);
+            _pool->hits.fetch_add(1, std::memory_order_relaxed);
+        } else {
+            clonixin::_internals::ArenaBinding no_arena(nullptr);
+            clonixin::_internals::ScopeBinding no_scope(nullptr);
+
+            _pool->misses.fetch_add(1, std::memory_order_relaxed);
+            obj = ::new T(utils::value::_internals::__value_unwrapper<As>::value(container)...);
+        }
+        return std::shared_ptr<Base>(std::shared_ptr<T>(obj, _internals::PoolDeleter<T>{ _pool }));
+    }
+
+    /**
+    ** \brief Get an instance from the pool, building it if there is none
+    ** idle.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns the instance, inside a
+    ** std::shared_ptr<Base> putting it back in the pool when released,
+    ** wrapped in a std::any.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::any PooledBuilder<Base, T, N, As...>::buildPtr(Container const &container) const {
+        return _acquire(container);
+    }
+
+    /**
+    ** \brief Pooled instances cannot be returned by value.
+    **
+    ** \throw exceptions::BuilderException<exceptions::BuilderError::RvalueUnsupported>
+    ** Always.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::any PooledBuilder<Base, T, N, As...>::buildVal([[maybe_unused]] Container const &container) const {
+        using Error = exceptions::BuilderError;
+        throw exceptions::BuilderException<Error::RvalueUnsupported>(
+                exceptions::BUILDER_ERROR_DESC[(size_t)Error::RvalueUnsupported] + typeid(T).name(),
+                __FILE__, __LINE__
+                );
+    }
+
+    /**
+    ** \brief Get a std::type_index describing the type to be built.
+    **
+    ** \return The std::type_index of Base.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::type_index PooledBuilder<Base, T, N, As...>::getTypeIndex() const noexcept {
+        return typeid(Base);
+    }
+
+    /**
+    ** \brief Get the types requested to the container when building an
+    ** instance.
+    **
+    ** These are the types listed in As, value holding types excepted.
+    **
+    ** \return The dense identifiers of the requested types.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::vector<utils::type_id_t> PooledBuilder<Base, T, N, As...>::getDependencies() const {
+        std::vector<utils::type_id_t> deps;
+
+        (utils::value::_internals::__value_unwrapper<As>::dependencies(deps), ...);
+        return deps;
+    }
+
+    /**
+    ** \brief Get an instance from the pool, as buildPtr does, without the
+    ** std::any.
+    **
+    ** \param container Clonixin IoC container.
+    **
+    ** \return This function returns the instance, inside a
+    ** std::shared_ptr<void> pointing to its Base.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::shared_ptr<void> PooledBuilder<Base, T, N, As...>::buildShared(Container const &container) const {
+        return _acquire(container);
+    }
+
+    /**
+    ** \brief Wrap a pointer returned by buildShared in a std::any.
+    **
+    ** \param ptr A pointer returned by buildShared.
+    **
+    ** \return This function returns the instance, inside a std::shared_ptr<Base>,
+    ** wrapped in a std::any.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline std::any PooledBuilder<Base, T, N, As...>::wrapShared(std::shared_ptr<void> const &ptr) const {
+        return std::static_pointer_cast<Base>(ptr);
+    }
+
+    /**
+    ** \brief Get the usage statistics of the pool.
+    **
+    ** \return Hits, misses, idle instances and capacity of the pool.
+    */
+    template <class Base, class T, std::size_t N, typename... As>
+    inline PoolStats PooledBuilder<Base, T, N, As...>::getPoolStats() const noexcept {
+        return {
+            _pool->hits.load(std::memory_order_relaxed),
+            _pool->misses.load(std::memory_order_relaxed),
+            _pool->idle.load(std::memory_order_relaxed),
+            _pool->capacity
+        };
+    }
+}
+
+#endif
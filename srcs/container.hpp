@@ -2,6 +2,9 @@
 #define clx_container_hpp__
 
 #include <containers/Container.hpp>
+#include <containers/RegistrationSet.hpp>
+#include <containers/StaticContainer.hpp>
+#include <inject.hpp>
 
 /**
 ** \brief Base Clonixin Namespace
@@ -0,0 +1,112 @@
+/**
+** \file ArenaScope.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 18:10
+** \date Last update: 2026-10-17 18:10
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_ArenaScope_hpp__
+#define containers_ArenaScope_hpp__
+
+#include <cstddef>
+#include <memory_resource>
+
+namespace clonixin {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Arena bound to the calling thread, if any.
+        **
+        ** Transients requested while an arena is bound are allocated from it.
+        */
+        inline std::pmr::memory_resource *&currentArena() noexcept {
+            static thread_local std::pmr::memory_resource *current = nullptr;
+            return current;
+        }
+
+        /**
+        ** \internal
+        ** \brief Bind an arena to the calling thread, until destroyed.
+        **
+        ** Binding nullptr suspends the current arena. The container does so
+        ** while building instances that outlive the request, such as
+        ** singletons, so that the transients they depend on are not taken
+        ** from an arena released before them.
+        */
+        class ArenaBinding {
+            public:
+                explicit ArenaBinding(std::pmr::memory_resource *resource) noexcept : _previous(currentArena()) {
+                    currentArena() = resource;
+                }
+                ArenaBinding(ArenaBinding const &) = delete;
+                ArenaBinding &operator=(ArenaBinding const &) = delete;
+                ~ArenaBinding() { currentArena() = _previous; }
+
+            private:
+                std::pmr::memory_resource *_previous;
+        };
+    }
+
+    /**
+    ** \brief Arena backing the transients requested on the calling thread.
+    **
+    ** While an ArenaScope is alive, every transient built on the thread that
+    ** created it, by any container, is allocated from a monotonic buffer,
+    ** along with its shared_ptr control block. Nothing is freed until the
+    ** scope is destroyed, at which point the whole arena is released at
+    ** once.
+    **
+    ** Instances with a longer lifetime, such as singletons, and the
+    ** transients they depend on, are still allocated normally. Transients
+    ** returned by value are not affected either.
+    **
+    ** \warning Instances built within an arena scope must not outlive it.
+    **
+    ** Arena scopes can be nested: the innermost one is used, and the previous
+    ** one is restored when it's destroyed.
+    */
+    class ArenaScope {
+        public:
+            explicit ArenaScope(std::size_t initial_size = 4096);
+            ArenaScope(void *buffer, std::size_t size);
+            ArenaScope(ArenaScope const &) = delete;
+            ArenaScope &operator=(ArenaScope const &) = delete;
+
+            std::pmr::memory_resource *resource() noexcept;
+
+        private:
+            std::pmr::monotonic_buffer_resource _arena;
+            _internals::ArenaBinding _binding;
+    };
+
+    /**
+    ** \brief Create an arena, and bind it to the calling thread.
+    **
+    ** \param initial_size Size of the first buffer allocated by the arena.
+    ** It grows when exhausted.
+    */
+    inline ArenaScope::ArenaScope(std::size_t initial_size)
+    : _arena(initial_size), _binding(&_arena) {}
+
+    /**
+    ** \brief Create an arena using a given buffer first, and bind it to the
+    ** calling thread.
+    **
+    ** \param buffer Buffer to allocate from, before allocating more from the
+    ** heap. It must outlive the scope.
+    ** \param size Size of buffer.
+    */
+    inline ArenaScope::ArenaScope(void *buffer, std::size_t size)
+    : _arena(buffer, size), _binding(&_arena) {}
+
+    /**
+    ** \brief Get the memory resource of the arena.
+    */
+    inline std::pmr::memory_resource *ArenaScope::resource() noexcept {
+        return &_arena;
+    }
+}
+
+#endif
@@ -3,36 +3,72 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 16:10
-** \date Last update: 2021-06-13 00:22
+** \date Last update: 2026-10-18 12:20
 ** \copyright GNU Lesser Public Licence v3
 */
 
 #ifndef containers_Container_hpp__
 #define containers_Container_hpp__
 
+#include <algorithm>
 #include <any>
-#include <unordered_map>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <typeindex>
 #include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 #ifndef containers_ContainerFwd_hpp__
 #include "builders/IBuilder.hpp"
 #include "builders/GenericBuilder.hpp"
 #include "builders/AbstractBuilder.hpp"
+#include "builders/PooledBuilder.hpp"
+#include "builders/AllocatedBuilder.hpp"
+#include "builders/FlatBuilder.hpp"
+#endif
+
+#ifndef __CONTAINER_FWD_ONLY
+#include "./ResolutionPlan.hpp"
+#include "./Scope.hpp"
 #endif
 
+#include "builders/IPooledBuilder.hpp"
+#include "./ArenaScope.hpp"
+#include "./Registration.hpp"
+#include "./ResolutionStack.hpp"
 #include "./tag.hpp"
+#include "./WarmUp.hpp"
 #include "exceptions/ContainerException.hpp"
 #include "type_desc.hpp"
+#include "utils/Key.hpp"
+#include "utils/Rcu.hpp"
+#include "utils/TypeId.hpp"
 #include "utils/type_traits.hpp"
 
 namespace clonixin {
 #ifndef __CONTAINER_DECLARED
 #define __CONTAINER_DECLARED
 
+    class Scope;
+    template <class T> class ResolutionPlan;
+
+    namespace _internals {
+        struct CompiledPlan;
+        struct PlanState;
+    }
+
     /**
     ** \brief Clonixin's DI container.
     **
@@ -46,14 +82,18 @@ namespace clonixin {
     **
     ** \par Lifetime:
     ** The lifetime of a type represent how often a new instance will be created.
-    ** At the moment, there are only two possible values:
+    ** At the moment, there are five possible values:
     **  - Singleton: There will be only one instance of this type.
     **  - Transient: A new instance will be created each time it's requested.
+    **  - Scoped: There will be one instance of this type per Scope, created
+    **  with Container::createScope(). It must be requested through the scope.
+    **  - Cached: There will be only one instance of this type at a time. It's
+    **  destroyed once nothing references it anymore, and built again on the
+    **  next request.
+    **  - Pooled: A different instance is returned for each request, as with
+    **  Transient, but released instances are kept in a bounded pool and
+    **  handed out again, instead of building new ones.
     ** Some more lifetime are planned, but not developed yet. These include:
-    **  - Scoped: A type that'll act as a Singleton in a given scope. What that
-    **  means is that there will be a way to declare a scope, and as long as
-    **  it's valid, all variable created in the same C++ scope, or in subscope
-    **  will use the same instance.
     **  - Request: A type that act as a singleton, but only during a given
     **  request. This lifetime will enable to create one instance, that'll be
     **  reused when building all necessary instances. For example, you'll be
@@ -66,49 +106,149 @@ namespace clonixin {
     ** builder class.
     ** You then call Container::getInstance<T>() to retrieve an instance of type
     ** T.
+    **
+    ** \par Thread safety:
+    ** Once every type has been registered, instances can be requested from
+    ** several threads at once. Each singleton is built exactly once; threads
+    ** finding it already built only pay an atomic load, while threads asking
+    ** for a singleton being built wait for it. If waiting would deadlock,
+    ** because the builders of two singletons need each other, a
+    ** ContainerException<ContainerError::Deadlock> is thrown instead.
+    **
+    ** Each thread also keeps track of the types it is building. A builder
+    ** requesting, directly or not, a type it is itself building, as two
+    ** transients or a singleton needing each other, throws a
+    ** ContainerException<ContainerError::CircularDependency> naming the
+    ** whole chain, rather than recursing until the stack overflows.
+    **
+    ** Types can also be registered while other threads are requesting
+    ** instances. Registrations are kept in an immutable snapshot: requests
+    ** resolve against the snapshot current when they started, without taking
+    ** any lock, while each registration publishes an updated copy of it.
+    ** Registrations are serialized with each other.
+    **
+    ** \par Allocation:
+    ** Transients requested while an ArenaScope is alive on the calling thread
+    ** are allocated from its arena, and released all at once with it.
+    ** Otherwise, singletons and transients are allocated from the resources
+    ** given to Container::setSingletonResource and
+    ** Container::setTransientResource, if any.
+    **
+    ** The bookkeeping of the container itself, registry snapshots,
+    ** registrations and the builders it makes, is allocated from the memory
+    ** resource given on construction. Exceptions, which outlive the call
+    ** that threw them, keep allocating their message from the global heap.
     */
     class Container {
         public:
+            Container();
+            explicit Container(std::pmr::memory_resource *resource);
             virtual ~Container() {}
-            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder) noexcept;
+            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder);
             virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::once_t);
-            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t) noexcept;
-            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t) noexcept;
+            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t);
+            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t);
+            virtual Container &addTransient(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::append_t);
 
-            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder) noexcept;
+            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder);
             virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::once_t);
-            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t) noexcept;
-            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t) noexcept;
+            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t);
+            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t);
+            virtual Container &addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::append_t);
 
-            template <class T> Container &addInstance(std::unique_ptr<T> &&obj) noexcept;
+            template <class T> Container &addInstance(std::unique_ptr<T> &&obj);
             template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::once_t);
-            template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::ignore_t) noexcept;
-            template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::override_t) noexcept;
+            template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::ignore_t);
+            template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::override_t);
+            template <class T> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::append_t);
+            template <class T, utils::key_hash_t K> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::key_t<K>);
+            template <class T, utils::key_hash_t K, typename Tag> Container &addInstance(std::unique_ptr<T> &&obj, tag::container::key_t<K>, Tag);
 
-            template <class TypeDesc, typename... As> Container & addType() noexcept;
+            template <class TypeDesc, typename... As> Container & addType();
             template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::once_t);
-            template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::ignore_t) noexcept;
-            template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::override_t) noexcept;
+            template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::ignore_t);
+            template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::override_t);
+            template <class TypeDesc, typename... As> Container & addType(tag::container::duplicate::append_t);
+            template <class TypeDesc, typename... As, utils::key_hash_t K> Container & addType(tag::container::key_t<K>);
+            template <class TypeDesc, typename... As, utils::key_hash_t K, typename Tag> Container & addType(tag::container::key_t<K>, Tag);
+            template <class TypeDesc, typename... As, class Alloc> Container & addType(std::allocator_arg_t, Alloc const &alloc);
+            template <class TypeDesc, typename... As, class Alloc> Container & addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::once_t);
+            template <class TypeDesc, typename... As, class Alloc> Container & addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::ignore_t);
+            template <class TypeDesc, typename... As, class Alloc> Container & addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::override_t);
+            template <class TypeDesc, typename... As, class Alloc> Container & addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::append_t);
+            template <class Set> Container & addTypes();
+
+            Container &seal();
+            bool isSealed() const noexcept;
+
+            Container &setSingletonResource(std::pmr::memory_resource *resource);
+            Container &setTransientResource(std::pmr::memory_resource *resource);
+            std::pmr::memory_resource *getTransientResource() const noexcept;
+
+            template <class Executor> std::vector<WarmUpTiming> warmUp(Executor &&executor) const;
+            std::vector<WarmUpTiming> warmUp() const;
+
+            Scope createScope() const;
+
+            template <class T> ResolutionPlan<T> compilePlan() const;
+
+            template <class T> builders::PoolStats getPoolStats() const;
+
+            std::shared_ptr<builders::IBuilder const> getTransientBuilder(utils::type_id_t id) const;
 
             virtual std::any getInstance(tag::container::ptr_t, std::type_index t) const;
             virtual std::any getInstance(tag::container::rref_t, std::type_index t) const;
+            virtual std::any getInstance(tag::container::ptr_t, utils::type_id_t id) const;
+            virtual std::any getInstance(tag::container::rref_t, utils::type_id_t id) const;
 
             template <class T> std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> getInstance() const;
             template <class T> std::enable_if_t<std::is_rvalue_reference_v<T>, T &&> getInstance() const;
+            template <class T, utils::key_hash_t K> std::shared_ptr<T> getInstance(tag::container::key_t<K>) const;
+            template <class... Ts> std::tuple<std::shared_ptr<Ts>...> getInstances() const;
+            template <class T> std::vector<std::shared_ptr<T>> getAll() const;
+
+            template <class T> T resolve() const;
 
         private:
+            template <class T> friend class ResolutionPlan;
+
             virtual std::any _typeNotFound(tag::container::ptr_t, std::type_index) const;
             virtual std::any _typeNotFound(tag::container::rref_t, std::type_index) const;
-            template <typename Tag> void _addTransient(std::unique_ptr<builders::IBuilder> &&builder, Tag) noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>);
-            template <typename Tag> void _addSingleton(std::unique_ptr<builders::IBuilder> &&builder, Tag) noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>);
-            template <class T, typename Tag> void _addInstance(std::unique_ptr<T> &&obj, Tag) noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>);
-            template <typename Tag, class TypeDesc, typename... As> void _addType() noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>);
+            template <typename Tag> void _addTransient(std::unique_ptr<builders::IBuilder> &&builder, Tag);
+            template <typename Tag> void _addSingleton(std::unique_ptr<builders::IBuilder> &&builder, Tag);
+            template <class T, typename Tag> void _addInstance(std::unique_ptr<T> &&obj, Tag, utils::type_id_t id);
+            template <typename Tag, class TypeDesc, typename... As> void _addType(utils::type_id_t id);
+            template <typename Tag, class TypeDesc, class Alloc, typename... As> void _addAllocatedType(Alloc const &alloc);
+            template <typename Tag, class TypeDesc, class Regs, typename... As> void _addFlatType(utils::type_id_t id);
+            template <class... Regs> void _addTypes(type_traits::type_list<Regs...>);
+            template <class Reg, typename... As, class... Regs> void _addRegistration(type_traits::type_list<As...>, type_traits::type_list<Regs...>);
+            template <typename Tag> void _register(utils::type_id_t id, _internals::Registration &&reg);
+            template <class B, typename... Args> std::shared_ptr<B> _makeBuilder(Args &&...args) const;
+            std::shared_ptr<builders::IBuilder> _adoptBuilder(std::unique_ptr<builders::IBuilder> &&builder) const;
+            static _internals::Registration *_find(_internals::Registry const &registry, utils::type_id_t id) noexcept;
+            static std::optional<utils::type_id_t> _findSealed(_internals::Registry const &registry, std::type_index t) noexcept;
+            void _buildSingleton(_internals::Registration &reg, utils::type_id_t id) const;
+            std::any _getCached(_internals::Registration &reg, utils::type_id_t id) const;
+            std::shared_ptr<void> _getCachedShared(_internals::Registration &reg, utils::type_id_t id) const;
+            std::shared_ptr<void> _getShared(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const;
+            template <class T> std::shared_ptr<T> _getInstance(_internals::Registry const &registry, utils::type_id_t id) const;
+            template <class T> std::shared_ptr<T> _getMember(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const;
+            std::any _getAny(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const;
+            void _waitForBuild(std::unique_lock<std::mutex> &lock, _internals::Registration const &reg, utils::type_id_t id) const;
+            std::any _getScoped(_internals::Registration const &reg, utils::type_id_t id) const;
+            static std::vector<_internals::WarmUpNode> _warmUpGraph(_internals::Registry const &registry);
+            static std::size_t _warmUpReachable(std::vector<_internals::WarmUpNode> const &nodes);
+            static std::shared_ptr<_internals::CompiledPlan const> _compilePlan(_internals::Registry const &registry, utils::type_id_t id);
+            template <class T> std::shared_ptr<T> _runPlan(_internals::PlanState &state) const;
+            std::shared_ptr<void> _executePlan(_internals::Registry const &registry, _internals::CompiledPlan const &plan) const;
 
         private:
-            mutable std::unordered_map<std::type_index, std::any> _singleton_map;
-            std::unordered_map<std::type_index, std::unique_ptr<builders::IBuilder>> _builder_map;
+            std::pmr::memory_resource *_resource;
+            utils::_internals::Rcu<_internals::Registry> _registry;
 
-            std::unordered_map<std::type_index, type_desc::Lifetime> _life_map;
+            mutable std::mutex _init_mutex;
+            mutable std::condition_variable _init_cv;
+            mutable std::pmr::unordered_map<std::thread::id, _internals::Registration const *> _waiting;
     };
 #endif
 
@@ -116,6 +256,25 @@ namespace clonixin {
 
 #include "utils/ValueWrapper.hpp"
 
+    /**
+    ** \brief Create an empty container, allocating from the global heap.
+    */
+    inline Container::Container() : Container(std::pmr::new_delete_resource()) {}
+
+    /**
+    ** \brief Create an empty container, allocating its bookkeeping from a
+    ** given memory resource.
+    **
+    ** Registry snapshots, registrations, and the builders made by addType,
+    ** are allocated from the resource. Builders given to addTransient or
+    ** addSingleton only have their control block allocated from it.
+    **
+    ** \param resource The resource, which must outlive the container and
+    ** every instance it built.
+    */
+    inline Container::Container(std::pmr::memory_resource *resource)
+    : _resource(resource), _registry(resource), _waiting(resource) {}
+
     /**
     ** \brief Register a class builder to the container.
     **
@@ -123,9 +282,12 @@ namespace clonixin {
     **
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    inline Container & Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder) noexcept {
+    inline Container & Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder) {
         _addTransient(std::move(builder), tag::container::duplicate::over);
         return *this;
     }
@@ -141,6 +303,9 @@ namespace clonixin {
     ** \throw exceptions::ContainerException<exceptions::ContainerError::DuplicateType>
     ** Thrown if the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     inline Container &Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder,
@@ -157,10 +322,13 @@ namespace clonixin {
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     ** \param tag a value to disambiguate function call.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     inline Container &Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder,
-            [[maybe_unused]]tag::container::duplicate::ignore_t tag) noexcept {
+            [[maybe_unused]]tag::container::duplicate::ignore_t tag) {
         _addTransient(std::move(builder), tag);
         return *this;
     }
@@ -173,10 +341,33 @@ namespace clonixin {
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     ** \param tag a value to disambiguate function call.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    inline Container &Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder,
+            [[maybe_unused]]tag::container::duplicate::override_t tag) {
+        _addTransient(std::move(builder), tag);
+        return *this;
+    }
+
+    /**
+    ** \brief Register a class builder to the container.
+    **
+    ** If the type build by this builder already exists, the builder is kept
+    ** alongside the existing ones, and is used for further requests.
+    **
+    ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
+    ** \param tag a value to disambiguate function call.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     inline Container &Container::addTransient(std::unique_ptr<builders::IBuilder> &&builder,
-            [[maybe_unused]]tag::container::duplicate::override_t tag) noexcept {
+            [[maybe_unused]]tag::container::duplicate::append_t tag) {
         _addTransient(std::move(builder), tag);
         return *this;
     }
@@ -197,33 +388,18 @@ namespace clonixin {
     ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the type has already been registered.
     */
     template <typename Tag>
-    inline void Container::_addTransient(std::unique_ptr<builders::IBuilder> &&builder, [[maybe_unused]]Tag tag)
-    noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>) {
-        auto ti = builder->getTypeIndex();
+    inline void Container::_addTransient(std::unique_ptr<builders::IBuilder> &&builder, [[maybe_unused]]Tag tag) {
+        auto id = utils::typeId(builder->getTypeIndex());
 
         using namespace tag::container::duplicate;
-        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t>,
-                "Tag should be one of override_t, once_t or ignore_t");
-
-        if constexpr (!std::is_same_v<Tag, override_t>) {
-            if (_life_map.find(ti) != _life_map.end()) {
-                if constexpr (std::is_same_v<Tag, tag::container::duplicate::once_t>) {
-                    using type_desc::Lifetime;
-                    using Error = clonixin::exceptions::ContainerError;
-                    throw exceptions::ContainerException<Error::DuplicateType>(
-                            exceptions::CONTAINER_ERROR_DESC[(size_t)Error::DuplicateType] + ti.name(),
-                            __FILE__, __LINE__
-                            );
-                } else {
-                    return;
-                }
-            }
-        }
+        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t, append_t>,
+                "Tag should be one of override_t, once_t, ignore_t or append_t");
 
-        _builder_map[ti] = std::move(builder);
-        _life_map[ti] = type_desc::Lifetime::Transient;
+        _internals::Registration reg;
 
-        return;
+        reg.lifetime = type_desc::Lifetime::Transient;
+        reg.builder = _adoptBuilder(std::move(builder));
+        _register<Tag>(id, std::move(reg));
     }
 
     /**
@@ -233,9 +409,12 @@ namespace clonixin {
     **
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    inline Container & Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder) noexcept {
+    inline Container & Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder) {
         _addSingleton(std::move(builder), tag::container::duplicate::over);
         return *this;
     }
@@ -251,6 +430,9 @@ namespace clonixin {
     ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
     ** thrown if the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::once_t tag) {
@@ -266,9 +448,12 @@ namespace clonixin {
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     ** \param tag a value to disambiguate function call.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t tag) noexcept {
+    inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::ignore_t tag) {
         _addSingleton(std::move(builder), tag);
         return *this;
     }
@@ -281,9 +466,31 @@ namespace clonixin {
     ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
     ** \param tag a value to disambiguate function call.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t tag) {
+        _addSingleton(std::move(builder), tag);
+        return *this;
+    }
+
+    /**
+    ** \brief Register a singleton builder to the container
+    **
+    ** If the type build by this builder already exists, the builder is kept
+    ** alongside the existing ones, and is used for further requests.
+    **
+    ** \param builder an rvalue reference to a std::unique_ptr<IBuilder>.
+    ** \param tag a value to disambiguate function call.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::override_t tag) noexcept {
+    inline Container &Container::addSingleton(std::unique_ptr<builders::IBuilder> &&builder, tag::container::duplicate::append_t tag) {
         _addSingleton(std::move(builder), tag);
         return *this;
     }
@@ -305,31 +512,18 @@ namespace clonixin {
     ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the type has already been registered.
     */
     template <typename Tag>
-    void Container::_addSingleton(std::unique_ptr<builders::IBuilder> &&builder, [[maybe_unused]]Tag)
-    noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>) {
-        auto ti= builder->getTypeIndex();
+    void Container::_addSingleton(std::unique_ptr<builders::IBuilder> &&builder, [[maybe_unused]]Tag) {
+        auto id = utils::typeId(builder->getTypeIndex());
 
         using namespace tag::container::duplicate;
-        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t>,
-                "Tag should be one of override_t, once_t or ignore_t");
+        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t, append_t>,
+                "Tag should be one of override_t, once_t, ignore_t or append_t");
 
+        _internals::Registration reg;
 
-        if constexpr (!std::is_same_v<Tag, override_t>) {
-            if (_life_map.find(ti) != _life_map.end()) {
-                if constexpr (std::is_same_v<Tag, tag::container::duplicate::once_t>) {
-                    using type_desc::Lifetime;
-                    using Error = clonixin::exceptions::ContainerError;
-                    throw exceptions::ContainerException<Error::DuplicateType>(
-                            exceptions::CONTAINER_ERROR_DESC[(size_t)Error::DuplicateType] + ti.name(),
-                            __FILE__, __LINE__
-                            );
-                } else {
-                    return;
-                }
-            }
-        }
-        _builder_map[ti] = std::move(builder);
-        _life_map[ti] = type_desc::Lifetime::Singleton;
+        reg.lifetime = type_desc::Lifetime::Singleton;
+        reg.builder = _adoptBuilder(std::move(builder));
+        _register<Tag>(id, std::move(reg));
     }
 
     /**
@@ -341,11 +535,14 @@ namespace clonixin {
     **
     ** \tparam T Type of the object.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class T>
-    inline Container & Container::addInstance(std::unique_ptr<T> &&obj) noexcept {
-        _addInstance(std::move(obj), tag::container::duplicate::over);
+    inline Container & Container::addInstance(std::unique_ptr<T> &&obj) {
+        _addInstance(std::move(obj), tag::container::duplicate::over, utils::typeId<T>());
 
         return *this;
     }
@@ -363,10 +560,13 @@ namespace clonixin {
     ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
     ** thrown if the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::once_t tag) {
-        _addInstance(std::move(obj), tag);
+        _addInstance(std::move(obj), tag, utils::typeId<T>());
         return *this;
     }
 
@@ -379,10 +579,13 @@ namespace clonixin {
     **
     ** \tparam T Type of the object.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::ignore_t tag) noexcept {
-        _addInstance(std::move(obj), tag);
+    template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::ignore_t tag) {
+        _addInstance(std::move(obj), tag, utils::typeId<T>());
         return *this;
     }
 
@@ -395,10 +598,89 @@ namespace clonixin {
     **
     ** \tparam T Type of the object.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::override_t tag) {
+        _addInstance(std::move(obj), tag, utils::typeId<T>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a singleton instance in the container.
+    **
+    ** If the type is already exists, the instance is kept alongside the
+    ** existing ones, and is returned by further requests.
+    **
+    ** \param obj The instance to register.
+    **
+    ** \tparam T Type of the object.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::append_t tag) {
+        _addInstance(std::move(obj), tag, utils::typeId<T>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a singleton instance in the container, under a key.
+    **
+    ** The instance is only returned when T is requested under the same key,
+    ** so several instances of T can be registered, each under its own key.
+    ** If an instance was already registered under this key, it will be
+    ** overridden.
+    **
+    ** \code
+    ** using namespace clonixin::utils::literals;
+    ** c.addInstance(std::make_unique<Pool>(4), clonixin::tag::key<"primary"_key>);
+    ** \endcode
+    **
+    ** \param obj The instance to register.
+    **
+    ** \tparam T Type of the object.
+    ** \tparam K The hash of the key.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class T, utils::key_hash_t K>
+    inline Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::key_t<K>) {
+        _addInstance(std::move(obj), tag::container::duplicate::over, utils::keyedTypeId<T, K>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a singleton instance in the container, under a key.
+    **
+    ** \see Container::addInstance(std::unique_ptr<T> &&, tag::container::key_t<K>)
+    **
+    ** \param obj The instance to register.
+    ** \param tag A duplicate tag, handling an instance already registered
+    ** under this key.
+    **
+    ** \tparam T Type of the object.
+    ** \tparam K The hash of the key.
+    ** \tparam Tag Type of the duplicate tag.
+    **
+    ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
+    ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the key has already been registered.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
-    template <class T> Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::duplicate::override_t tag) noexcept {
-        _addInstance(std::move(obj), tag);
+    template <class T, utils::key_hash_t K, typename Tag>
+    inline Container &Container::addInstance(std::unique_ptr<T> &&obj, tag::container::key_t<K>, Tag tag) {
+        _addInstance(std::move(obj), tag, utils::keyedTypeId<T, K>());
         return *this;
     }
 
@@ -406,6 +688,7 @@ namespace clonixin {
     ** \brief Register a singleton instance in the container.
     **
     ** \param obj The instance to register.
+    ** \param id Dense identifier to register the instance as.
     **
     ** \tparam T Type of the object.
     ** \tparam Tag type to disambiguate behavior.
@@ -413,34 +696,33 @@ namespace clonixin {
     ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
     ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class T, typename Tag>
-    inline void Container::_addInstance(std::unique_ptr<T> &&obj, [[maybe_unused]]Tag)
-    noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>)
-    {
-        std::type_index ti = typeid(T);
-
+    inline void Container::_addInstance(std::unique_ptr<T> &&obj, [[maybe_unused]]Tag, utils::type_id_t id) {
         using namespace tag::container::duplicate;
-        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t>,
-                "Tag should be one of override_t, once_t or ignore_t");
-
-        if constexpr (!std::is_same_v<Tag, override_t>) {
-            if (_life_map.find(ti) != _life_map.end()) {
-                if constexpr (std::is_same_v<Tag, tag::container::duplicate::once_t>) {
-                    using type_desc::Lifetime;
-                    using Error = clonixin::exceptions::ContainerError;
-                    throw exceptions::ContainerException<Error::DuplicateType>(
-                            exceptions::CONTAINER_ERROR_DESC[(size_t)Error::DuplicateType] + ti.name(),
-                            __FILE__, __LINE__
-                            );
-                } else {
-                    return;
-                }
-            }
-        }
-        _singleton_map[ti] = std::shared_ptr(std::forward<std::unique_ptr<T> &&>(obj));
-        _life_map[ti] = type_desc::Lifetime::Singleton;
+        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t, append_t>,
+                "Tag should be one of override_t, once_t, ignore_t or append_t");
+
+        _internals::Registration reg;
+
+        reg.lifetime = type_desc::Lifetime::Singleton;
+        std::shared_ptr<T> instance;
+
+        if (auto *resource = _registry.read()->singleton_resource)
+            instance = std::shared_ptr<T>(obj.get(), obj.get_deleter(), std::pmr::polymorphic_allocator<T>(resource));
+        else
+            instance = std::shared_ptr<T>(obj.get(), obj.get_deleter());
+        obj.release();
+
+        reg.typed = true;
+        reg.shared = instance;
+        reg.instance = std::move(instance);
+        reg.state.store(_internals::Registration::State::Ready, std::memory_order_relaxed);
+        _register<Tag>(id, std::move(reg));
     }
 
     /**
@@ -462,11 +744,14 @@ namespace clonixin {
     ** on the fly or retrieved, as well as value wrapping types of the
     ** argument that cannot be built that way (strings, algebraic types, etc.)
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class TypeDesc, typename... As>
-    inline Container & Container::addType() noexcept {
-        _addType<tag::container::duplicate::override_t, TypeDesc, As...>();
+    inline Container & Container::addType() {
+        _addType<tag::container::duplicate::override_t, TypeDesc, As...>(utils::typeId<typename TypeDesc::regs>());
         return *this;
     }
 
@@ -492,11 +777,14 @@ namespace clonixin {
     ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
     ** thrown if the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class TypeDesc, typename... As>
     inline Container & Container::addType(tag::container::duplicate::once_t) {
-        _addType<tag::container::duplicate::once_t, TypeDesc, As...>();
+        _addType<tag::container::duplicate::once_t, TypeDesc, As...>(utils::typeId<typename TypeDesc::regs>());
         return *this;
     }
 
@@ -519,11 +807,14 @@ namespace clonixin {
     ** on the fly or retrieved, as well as value wrapping types of the
     ** argument that cannot be built that way (strings, algebraic types, etc.)
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class TypeDesc, typename... As>
-    inline Container & Container::addType(tag::container::duplicate::ignore_t) noexcept {
-        _addType<tag::container::duplicate::ignore_t, TypeDesc, As...>();
+    inline Container & Container::addType(tag::container::duplicate::ignore_t) {
+        _addType<tag::container::duplicate::ignore_t, TypeDesc, As...>(utils::typeId<typename TypeDesc::regs>());
         return *this;
     }
 
@@ -546,11 +837,101 @@ namespace clonixin {
     ** on the fly or retrieved, as well as value wrapping types of the
     ** argument that cannot be built that way (strings, algebraic types, etc.)
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As>
+    inline Container & Container::addType(tag::container::duplicate::override_t) {
+        _addType<tag::container::duplicate::override_t, TypeDesc, As...>(utils::typeId<typename TypeDesc::regs>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a type to the container, alongside the types already
+    ** registered as the same base.
+    **
+    ** This is how several implementations of an interface are registered:
+    ** each of them is kept, and Container::getAll returns an instance of
+    ** every one, in registration order. Other requests use the last one
+    ** registered.
+    **
+    ** \tparam TypeDesc A Type-descriptor type.
+    ** \tparam As Types of the class' constructor arguments, that will be built
+    ** on the fly or retrieved, as well as value wrapping types of the
+    ** argument that cannot be built that way (strings, algebraic types, etc.)
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <class TypeDesc, typename... As>
-    inline Container & Container::addType(tag::container::duplicate::override_t) noexcept {
-        _addType<tag::container::duplicate::override_t, TypeDesc, As...>();
+    inline Container & Container::addType(tag::container::duplicate::append_t) {
+        _addType<tag::container::duplicate::append_t, TypeDesc, As...>(utils::typeId<typename TypeDesc::regs>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a type to the container, under a key.
+    **
+    ** This is Container::addType(), except that the registration is only
+    ** used when the type is requested under the same key, with
+    ** getInstance<T>(tag::container::key_t<K>) or inject::Named. Several
+    ** registrations of a type, configured differently, can then live side by
+    ** side, each under its own key. If the type was already registered under
+    ** this key, it will be overridden.
+    **
+    ** \code
+    ** using namespace clonixin::utils::literals;
+    ** c.addType<Singleton<Pool>, Int<4>>(clonixin::tag::key<"primary"_key>);
+    ** \endcode
+    **
+    ** The key is hashed at compile time, and T under K is given a dense
+    ** identifier of its own, so keyed lookups cost the same as unkeyed ones.
+    **
+    ** \tparam TypeDesc A Type-descriptor type.
+    ** \tparam As Types of the class' constructor arguments, that will be built
+    ** on the fly or retrieved, as well as value wrapping types of the
+    ** argument that cannot be built that way (strings, algebraic types, etc.)
+    ** \tparam K The hash of the key.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As, utils::key_hash_t K>
+    inline Container & Container::addType(tag::container::key_t<K>) {
+        _addType<tag::container::duplicate::override_t, TypeDesc, As...>(utils::keyedTypeId<typename TypeDesc::regs, K>());
+        return *this;
+    }
+
+    /**
+    ** \brief Register a type to the container, under a key.
+    **
+    ** \see Container::addType(tag::container::key_t<K>)
+    **
+    ** \param tag A duplicate tag, handling a type already registered under
+    ** this key.
+    **
+    ** \tparam TypeDesc A Type-descriptor type.
+    ** \tparam As Types of the class' constructor arguments.
+    ** \tparam K The hash of the key.
+    ** \tparam Tag Type of the duplicate tag.
+    **
+    ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
+    ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the key has already been registered.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As, utils::key_hash_t K, typename Tag>
+    inline Container & Container::addType(tag::container::key_t<K>, Tag) {
+        _addType<Tag, TypeDesc, As...>(utils::keyedTypeId<typename TypeDesc::regs, K>());
         return *this;
     }
 
@@ -568,6 +949,8 @@ namespace clonixin {
     ** It's also possible to specify some values, either by passing a Direct<T>
     ** or an Indirect<T> type, that'll wrap the value.
     **
+    ** \param id Dense identifier to register the type as.
+    **
     ** \tparam Tag a type to select a behavior in case the type was already registered.
     ** \tparam TypeDesc A Type-descriptor type.
     ** \tparam As Types of the class' constructor arguments, that will be built
@@ -577,11 +960,13 @@ namespace clonixin {
     ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
     ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the type has already been registered.
     **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
     ** \return The current Container instance.
     */
     template <typename Tag, class TypeDesc, typename... As>
-    inline void Container::_addType()
-    noexcept(type_traits::is_one_of_v<Tag, tag::ignore_t, tag::override_t>) {
+    inline void Container::_addType(utils::type_id_t id) {
         using T = typename TypeDesc::type;
         using R = typename TypeDesc::regs;
 
@@ -592,122 +977,1240 @@ namespace clonixin {
         }
 
         using namespace tag::container::duplicate;
-        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t>,
-                "Tag should be one of override_t, once_t or ignore_t");
+        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t, append_t>,
+                "Tag should be one of override_t, once_t, ignore_t or append_t");
 
-        std::type_index ti = typeid(R);
-
-        if constexpr (!std::is_same_v<Tag, override_t>) {
-            if (_life_map.find(ti) != _life_map.end()) {
-                if constexpr (std::is_same_v<Tag, tag::container::duplicate::once_t>) {
-                    using type_desc::Lifetime;
-                    using Error = clonixin::exceptions::ContainerError;
-                    throw exceptions::ContainerException<Error::DuplicateType>(
-                            exceptions::CONTAINER_ERROR_DESC[(size_t)Error::DuplicateType] + ti.name(),
-                            __FILE__, __LINE__
-                            );
-                } else {
-                    return;
-                }
-            }
-        }
+        _internals::Registration reg;
 
-        if constexpr (TypeDesc::is_polymorph) {
+        if constexpr (TypeDesc::lifetime == type_desc::Lifetime::Pooled) {
+            reg.builder = _makeBuilder<builders::PooledBuilder<R, T, TypeDesc::pool_size, As...>>();
+        } else if constexpr (TypeDesc::is_polymorph) {
             using B = typename TypeDesc::base;
-            _builder_map[ti] = std::make_unique<builders::AbstractBuilder<B, T, As...>>();
+            reg.builder = _makeBuilder<builders::AbstractBuilder<B, T, As...>>();
         } else {
-            _builder_map[ti] = std::make_unique<builders::GenericBuilder<T, As...>>();
+            auto builder = _makeBuilder<builders::GenericBuilder<T, As...>>();
+
+            reg.value_builder = static_cast<builders::ITypedBuilder<T> const *>(builder.get());
+            reg.builder = std::move(builder);
         }
-        _life_map[ti] = TypeDesc::lifetime;
+        reg.lifetime = TypeDesc::lifetime;
+        reg.typed = true;
+        _register<Tag>(id, std::move(reg));
     }
 
     /**
-    ** \brief Get a given instance wrapped in a shared_ptr.
+    ** \brief Register a type to the container, allocating its instances with
+    ** a given allocator.
     **
-    ** This function build or retrieved a given instance, building every
-    ** needed types in the process, then return a std::shared_ptr to the
-    ** instances, by wrapping it in a std::any.
+    ** This is Container::addType(), except that instances are built with
+    ** allocate_shared, using a copy of alloc: each instance shares a single
+    ** allocation with its control block, and is released through the
+    ** allocator. Instances built while an ArenaScope is alive, or from the
+    ** resources set on the container, are still taken from that resource.
     **
-    ** \param t A std::type_index, that represent the type to be retrieved.
+    ** \tparam TypeDesc A Type-descriptor type. Pooled types are not
+    ** supported.
+    ** \tparam As Types of the class' constructor arguments, that will be built
+    ** on the fly or retrieved, as well as value wrapping types of the
+    ** argument that cannot be built that way (strings, algebraic types, etc.)
+    ** \tparam Alloc An allocator type.
     **
-    ** \return If the instance could be built, it's returned. Otherwise a
-    ** std::runtime_error will be thrown.
+    ** \param alloc The allocator to allocate instances with.
     **
-    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
-    ** Thrown if the type has not been registered.
-    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
-    ** Thrown if an invalid lifetime is found.
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
     **
+    ** \return The current Container instance.
     */
-    inline std::any Container::getInstance(tag::container::ptr_t, std::type_index t) const {
-        using type_desc::Lifetime;
-        using Error = clonixin::exceptions::ContainerError;
-        if (_life_map.find(t) == _life_map.end())
-            _typeNotFound(tag::container::ptr, t);
-
-        Lifetime l = _life_map.at(t);
-        switch (l) {
-            case Lifetime::Transient:
-                return _builder_map.at(t)->buildPtr(*this);
-            case Lifetime::Singleton:
-                if (_singleton_map.find(t) == _singleton_map.end())
-                    _singleton_map[t] = _builder_map.at(t)->buildPtr(*this);
-                return _singleton_map.at(t);
-            default: //GCOV_EXCL_START
-            throw exceptions::ContainerException<Error::BadLifetime>(
-                exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + t.name(),
-                __FILE__, __LINE__
-            );
-        } //GCOV_EXCL_STOP
+    template <class TypeDesc, typename... As, class Alloc>
+    inline Container & Container::addType(std::allocator_arg_t, Alloc const &alloc) {
+        _addAllocatedType<tag::container::duplicate::override_t, TypeDesc, Alloc, As...>(alloc);
+        return *this;
     }
 
     /**
-    ** \brief Get a given instance, as a rvalue..
+    ** \brief Register a type to the container, allocating its instances with
+    ** a given allocator.
     **
-    ** This function build or retrieved a given instance, building every
-    ** needed types in the process, then return it's value wrapped in a std::any.
-    **
-    ** \param t A std::type_index, that represent the type to be retrieved.
+    ** \see Container::addType(std::allocator_arg_t, Alloc const &)
     **
-    ** \return If the instance could be built, it's returned. Otherwise a
-    ** std::runtime_error will be thrown.
+    ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
+    ** thrown if the type has already been registered.
     **
-    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
-    ** Thrown if the type has not been registered.
-    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
-    ** Thrown if an invalid lifetime is found.
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
     **
+    ** \return The current Container instance.
     */
-    inline std::any Container::getInstance(tag::container::rref_t, std::type_index t) const {
-        using type_desc::Lifetime;
-        using Error = clonixin::exceptions::ContainerError;
-        if (_life_map.find(t) == _life_map.end())
-            _typeNotFound(tag::container::rref, t);
-
-        Lifetime l = _life_map.at(t);
-        switch (l) {
-            case Lifetime::Transient:
-                return _builder_map.at(t)->buildVal(*this);
-            case Lifetime::Singleton:
-                throw exceptions::ContainerException<Error::BadLifetime>(
-                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + t.name() +
-                        ". Cannot return a singleton using move semantics.",
-                        __FILE__, __LINE__
-                        );
-            default: //GCOV_EXCL_START
-            throw exceptions::ContainerException<Error::BadLifetime>(
-                exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + t.name(),
-                __FILE__, __LINE__
-            );
-        } //GCOV_EXCL_STOP
+    template <class TypeDesc, typename... As, class Alloc>
+    inline Container & Container::addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::once_t) {
+        _addAllocatedType<tag::container::duplicate::once_t, TypeDesc, Alloc, As...>(alloc);
+        return *this;
     }
 
     /**
-    ** \brief Get a given instance as a shared_ptr.
+    ** \brief Register a type to the container, allocating its instances with
+    ** a given allocator.
     **
-    ** This function build or retrieved a given instance, building every
-    ** needed types in the process, then return a std::shared_ptr to the
-    ** instances.
+    ** \see Container::addType(std::allocator_arg_t, Alloc const &)
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As, class Alloc>
+    inline Container & Container::addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::ignore_t) {
+        _addAllocatedType<tag::container::duplicate::ignore_t, TypeDesc, Alloc, As...>(alloc);
+        return *this;
+    }
+
+    /**
+    ** \brief Register a type to the container, allocating its instances with
+    ** a given allocator.
+    **
+    ** \see Container::addType(std::allocator_arg_t, Alloc const &)
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As, class Alloc>
+    inline Container & Container::addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::override_t) {
+        _addAllocatedType<tag::container::duplicate::override_t, TypeDesc, Alloc, As...>(alloc);
+        return *this;
+    }
+
+    /**
+    ** \brief Register a type to the container, allocating its instances with
+    ** a given allocator, alongside the types already registered as the same
+    ** base.
+    **
+    ** \see Container::addType(std::allocator_arg_t, Alloc const &)
+    ** \see Container::addType(tag::container::duplicate::append_t)
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class TypeDesc, typename... As, class Alloc>
+    inline Container & Container::addType(std::allocator_arg_t, Alloc const &alloc, tag::container::duplicate::append_t) {
+        _addAllocatedType<tag::container::duplicate::append_t, TypeDesc, Alloc, As...>(alloc);
+        return *this;
+    }
+
+    /**
+    ** \internal
+    ** \brief Register a type to the container, with an AllocatedBuilder.
+    **
+    ** \tparam Tag a type to select a behavior in case the type was already registered.
+    ** \tparam TypeDesc A Type-descriptor type.
+    ** \tparam Alloc An allocator type.
+    ** \tparam As Types of the class' constructor arguments.
+    **
+    ** \param alloc The allocator to allocate instances with.
+    */
+    template <typename Tag, class TypeDesc, class Alloc, typename... As>
+    inline void Container::_addAllocatedType(Alloc const &alloc) {
+        using T = typename TypeDesc::type;
+        using R = typename TypeDesc::regs;
+
+        {
+            using clonixin::utils::value::_internals::__value_unwrapper;
+            static_assert(std::is_constructible_v<T, typename __value_unwrapper<As>::type...>,
+                    "Cannot construct type.");
+        }
+
+        using namespace tag::container::duplicate;
+        static_assert(type_traits::is_one_of_v<Tag, once_t, override_t, ignore_t, append_t>,
+                "Tag should be one of override_t, once_t, ignore_t or append_t");
+        static_assert(TypeDesc::lifetime != type_desc::Lifetime::Pooled,
+                "Pooled types cannot be registered with an allocator.");
+
+        _internals::Registration reg;
+        auto builder = _makeBuilder<builders::AllocatedBuilder<R, T, Alloc, As...>>(alloc);
+
+        if constexpr (!TypeDesc::is_polymorph)
+            reg.value_builder = static_cast<builders::ITypedBuilder<T> const *>(builder.get());
+        reg.builder = std::move(builder);
+        reg.lifetime = TypeDesc::lifetime;
+        reg.typed = true;
+        _register<Tag>(utils::typeId<R>(), std::move(reg));
+    }
+
+    /**
+    ** \brief Register every type of a RegistrationSet to the container.
+    **
+    ** The set is validated at compile time first: a missing dependency, a
+    ** dependency cycle, or a singleton keeping a shorter-lived instance does
+    ** not compile, and the error names the faulty registration. The set
+    ** must therefore be self-contained.
+    **
+    ** Each registration is then added as with addType(). Types registered
+    ** several times in the set are added with the append duplicate tag, so
+    ** that getAll returns each of them.
+    **
+    ** As the whole set is known at compile time, a transient needing other
+    ** transients of the set builds them in place, with a FlatBuilder: a tree
+    ** of transients is built by a single constructor expression, and only
+    ** the other lifetimes are requested to the container. The transients
+    ** built in place are thus the ones of the set, even if another builder
+    ** is registered for their type afterwards.
+    **
+    ** \tparam Set A RegistrationSet.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    template <class Set>
+    inline Container & Container::addTypes() {
+        static_assert(Set::validate(), "Invalid registration set.");
+
+        _addTypes(typename Set::registrations{});
+        return *this;
+    }
+
+    /**
+    ** \internal
+    ** \brief Register each of Regs, in order.
+    */
+    template <class... Regs>
+    inline void Container::_addTypes(type_traits::type_list<Regs...> regs) {
+        (_addRegistration<Regs>(typename Regs::args{}, regs), ...);
+    }
+
+    /**
+    ** \internal
+    ** \brief Register a type_desc::With of a registration set.
+    **
+    ** \tparam Reg The registration.
+    ** \tparam As Types of the constructor arguments of Reg.
+    ** \tparam Regs Every registration of the set.
+    */
+    template <class Reg, typename... As, class... Regs>
+    inline void Container::_addRegistration(type_traits::type_list<As...>, type_traits::type_list<Regs...>) {
+        using namespace tag::container::duplicate;
+        using R = typename Reg::regs;
+        using Tag = std::conditional_t<(0 + ... + int(std::is_same_v<R, typename Regs::regs>)) != 1, append_t, override_t>;
+
+        if constexpr (Reg::lifetime == type_desc::Lifetime::Transient
+                && builders::_internals::__flattens<type_traits::type_list<Regs...>, As...>)
+            _addFlatType<Tag, typename Reg::desc, type_traits::type_list<Regs...>, As...>(utils::typeId<R>());
+        else
+            _addType<Tag, typename Reg::desc, As...>(utils::typeId<R>());
+    }
+
+    /**
+    ** \internal
+    ** \brief Register a transient of a registration set, with a FlatBuilder
+    ** building its transient dependencies from the set in place.
+    **
+    ** \tparam Tag a type to select a behavior in case the type was already registered.
+    ** \tparam TypeDesc A transient type descriptor.
+    ** \tparam Regs A type_list of every registration of the set.
+    ** \tparam As Types of the class' constructor arguments.
+    **
+    ** \param id Dense identifier to register the type as.
+    */
+    template <typename Tag, class TypeDesc, class Regs, typename... As>
+    inline void Container::_addFlatType(utils::type_id_t id) {
+        using T = typename TypeDesc::type;
+        using R = typename TypeDesc::regs;
+
+        {
+            using clonixin::utils::value::_internals::__value_unwrapper;
+            static_assert(std::is_constructible_v<T, typename __value_unwrapper<As>::type...>,
+                    "Cannot construct type.");
+        }
+
+        _internals::Registration reg;
+        auto builder = _makeBuilder<builders::FlatBuilder<R, T, Regs, As...>>();
+
+        if constexpr (!TypeDesc::is_polymorph)
+            reg.value_builder = static_cast<builders::ITypedBuilder<T> const *>(builder.get());
+        reg.builder = std::move(builder);
+        reg.lifetime = TypeDesc::lifetime;
+        reg.typed = true;
+        _register<Tag>(id, std::move(reg));
+    }
+
+    /**
+    ** \internal
+    ** \brief Store the registration of a type, according to the duplicate
+    ** handling policy.
+    **
+    ** This is the single write path shared by every add* function. If the
+    ** type was already registered, the existing record is either replaced,
+    ** left as is, or an exception is thrown, depending on Tag. With
+    ** append_t, it's replaced as well, but both records are kept in the
+    ** collection of the type.
+    **
+    ** The registration is stored in a copy of the current registry snapshot,
+    ** which is then published. Threads requesting instances at the same time
+    ** keep using the previous snapshot until they are done.
+    **
+    ** \param id Dense identifier of the type to register.
+    ** \param reg The registration to store.
+    **
+    ** \tparam Tag a type to select a behavior in case the type was already registered.
+    **
+    ** \throw clonixin:exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>
+    ** thrown if Tag is clonixin::tag::container::duplicate::once_t, and the type has already been registered.
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    */
+    template <typename Tag>
+    inline void Container::_register(utils::type_id_t id, _internals::Registration &&reg) {
+        using namespace tag::container::duplicate;
+        using Error = clonixin::exceptions::ContainerError;
+
+        _registry.update([this, id, &reg](_internals::Registry &registry) {
+            if (registry.sealed)
+                throw exceptions::ContainerException<Error::Sealed>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::Sealed] + utils::typeIndex(id).name(),
+                        __FILE__, __LINE__
+                        );
+
+            if (id >= registry.registrations.size())
+                registry.registrations.resize(id + 1);
+
+            auto &slot = registry.registrations[id];
+
+            if (slot) {
+                if constexpr (std::is_same_v<Tag, once_t>) {
+                    throw exceptions::ContainerException<Error::DuplicateType>(
+                            exceptions::CONTAINER_ERROR_DESC[(size_t)Error::DuplicateType] + utils::typeIndex(id).name(),
+                            __FILE__, __LINE__
+                            );
+                } else if constexpr (std::is_same_v<Tag, ignore_t>) {
+                    return false;
+                }
+            }
+            if (reg.lifetime == type_desc::Lifetime::Cached && !reg.cached)
+                reg.cached = std::allocate_shared<_internals::CachedInstance>(
+                        std::pmr::polymorphic_allocator<_internals::CachedInstance>(_resource));
+            if (reg.lifetime == type_desc::Lifetime::Scoped)
+                reg.scope_slot = !std::is_same_v<Tag, append_t> && slot && slot->lifetime == type_desc::Lifetime::Scoped
+                    ? slot->scope_slot
+                    : registry.scope_slots++;
+
+            auto stored = std::allocate_shared<_internals::Registration>(
+                    std::pmr::polymorphic_allocator<_internals::Registration>(_resource), std::move(reg));
+            auto &collections = registry.collections;
+
+            if constexpr (std::is_same_v<Tag, append_t>) {
+                if (id >= collections.size())
+                    collections.resize(id + 1);
+
+                auto collection = std::allocate_shared<_internals::Collection>(
+                        std::pmr::polymorphic_allocator<_internals::Collection>(_resource), _resource);
+
+                if (collections[id])
+                    collection->members = collections[id]->members;
+                else if (slot)
+                    collection->members.push_back(slot);
+                collection->members.push_back(stored);
+                collection->singletons = std::all_of(collection->members.begin(), collection->members.end(),
+                        [](auto const &member) { return member->lifetime == type_desc::Lifetime::Singleton; });
+                collections[id] = std::move(collection);
+            } else if (id < collections.size()) {
+                collections[id] = nullptr;
+            }
+            slot = std::move(stored);
+            ++registry.generation;
+            return true;
+        });
+    }
+
+    /**
+    ** \internal
+    ** \brief Make a builder, allocated along with its control block from the
+    ** memory resource of the container.
+    **
+    ** \tparam B Type of the builder.
+    **
+    ** \param args Arguments of the builder constructor.
+    **
+    ** \return The builder.
+    */
+    template <class B, typename... Args>
+    inline std::shared_ptr<B> Container::_makeBuilder(Args &&...args) const {
+        return std::allocate_shared<B>(std::pmr::polymorphic_allocator<B>(_resource), std::forward<Args>(args)...);
+    }
+
+    /**
+    ** \internal
+    ** \brief Take ownership of a builder given by the user, allocating its
+    ** control block from the memory resource of the container.
+    **
+    ** \param builder The builder.
+    **
+    ** \return The builder.
+    */
+    inline std::shared_ptr<builders::IBuilder> Container::_adoptBuilder(std::unique_ptr<builders::IBuilder> &&builder) const {
+        return std::shared_ptr<builders::IBuilder>(builder.release(), std::default_delete<builders::IBuilder>(),
+                std::pmr::polymorphic_allocator<builders::IBuilder>(_resource));
+    }
+
+    /**
+    ** \internal
+    ** \brief Find the registration of a type.
+    **
+    ** \param registry The registry snapshot to look into.
+    ** \param id Dense identifier of the type.
+    **
+    ** \return A pointer to the registration, or nullptr if the type has not
+    ** been registered.
+    */
+    inline _internals::Registration *Container::_find(_internals::Registry const &registry, utils::type_id_t id) noexcept {
+        if (id >= registry.registrations.size())
+            return nullptr;
+        return registry.registrations[id].get();
+    }
+
+    /**
+    ** \brief Seal the container.
+    **
+    ** Once sealed, the registrations of a container are frozen: every add*
+    ** function throws, and registrations are compacted into their final
+    ** layout. The registry snapshot never changes again, and type-erased
+    ** lookups go through a sorted table local to the container instead of
+    ** the process-wide type id registry.
+    **
+    ** Sealing an already sealed container has no effect.
+    **
+    ** \return The current Container instance.
+    */
+    inline Container &Container::seal() {
+        _registry.update([](_internals::Registry &registry) {
+            auto &registrations = registry.registrations;
+
+            if (registry.sealed)
+                return false;
+
+            while (!registrations.empty() && !registrations.back())
+                registrations.pop_back();
+            registrations.shrink_to_fit();
+
+            while (!registry.collections.empty() && !registry.collections.back())
+                registry.collections.pop_back();
+            registry.collections.shrink_to_fit();
+
+            for (utils::type_id_t id = 0; id < registrations.size(); ++id) {
+                if (!registrations[id])
+                    continue;
+
+                std::type_index t = utils::typeIndex(id);
+                registry.sealed_index.push_back({ t.hash_code(), t, id });
+            }
+            std::sort(registry.sealed_index.begin(), registry.sealed_index.end(),
+                    [](auto const &lhs, auto const &rhs) { return lhs.hash < rhs.hash; });
+            registry.sealed_index.shrink_to_fit();
+
+            registry.sealed = true;
+            return true;
+        });
+        return *this;
+    }
+
+    /**
+    ** \brief Check whether the container has been sealed.
+    **
+    ** \return true if Container::seal() has been called.
+    */
+    inline bool Container::isSealed() const noexcept {
+        return _registry.read()->sealed;
+    }
+
+    /**
+    ** \brief Set the memory resource singletons are allocated from.
+    **
+    ** Singletons built afterwards are allocated, along with their control
+    ** block, from the resource. Instances registered afterwards with
+    ** addInstance have their control block allocated from it.
+    **
+    ** \param resource The resource, which must outlive every singleton. Null
+    ** to go back to the global heap.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    inline Container &Container::setSingletonResource(std::pmr::memory_resource *resource) {
+        using Error = clonixin::exceptions::ContainerError;
+
+        _registry.update([resource](_internals::Registry &registry) {
+            if (registry.sealed)
+                throw exceptions::ContainerException<Error::Sealed>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::Sealed] + "singleton resource",
+                        __FILE__, __LINE__
+                        );
+            registry.singleton_resource = resource;
+            return true;
+        });
+        return *this;
+    }
+
+    /**
+    ** \brief Set the memory resource transients are allocated from.
+    **
+    ** Transients built afterwards outside of an ArenaScope are allocated,
+    ** along with their control block, from the resource.
+    **
+    ** \param resource The resource, which must outlive every transient, and
+    ** be usable from every thread requesting them. Null to go back to the
+    ** global heap.
+    **
+    ** \throw clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>
+    ** Thrown if the container has been sealed.
+    **
+    ** \return The current Container instance.
+    */
+    inline Container &Container::setTransientResource(std::pmr::memory_resource *resource) {
+        using Error = clonixin::exceptions::ContainerError;
+
+        _registry.update([resource](_internals::Registry &registry) {
+            if (registry.sealed)
+                throw exceptions::ContainerException<Error::Sealed>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::Sealed] + "transient resource",
+                        __FILE__, __LINE__
+                        );
+            registry.transient_resource = resource;
+            return true;
+        });
+        return *this;
+    }
+
+    /**
+    ** \brief Get the memory resource transients are allocated from.
+    **
+    ** \return The resource, or null if transients are allocated from the
+    ** global heap.
+    */
+    inline std::pmr::memory_resource *Container::getTransientResource() const noexcept {
+        return _registry.read()->transient_resource;
+    }
+
+    /**
+    ** \brief Build every registered singleton, in parallel.
+    **
+    ** The dependency graph of the singletons is extracted from their
+    ** builders, transients being looked through, and singletons are then
+    ** built in topological order: each one is handed to the executor as soon
+    ** as every singleton it depends on is built, so that independent
+    ** singletons are built at the same time. Singletons whose dependencies
+    ** cannot be known, because they were registered with a custom builder,
+    ** are built first, along with their own dependencies. Singletons part of
+    ** a dependency cycle are finally built on the calling thread, which
+    ** reports the cycle.
+    **
+    ** The function returns once every singleton is built. The first request
+    ** of a singleton then only has to read it.
+    **
+    ** \tparam Executor Callable taking a std::function<void()>, and running
+    ** it once, on any thread, at any time. It may be called from the tasks
+    ** it runs. This is typically a thread pool's submit function.
+    **
+    ** \param executor The executor running the construction tasks.
+    **
+    ** \throw Whatever the first failing builder threw, once every other
+    ** singleton has been built.
+    **
+    ** \return Construction time of each singleton built, in the order they
+    ** were built.
+    */
+    template <class Executor>
+    inline std::vector<WarmUpTiming> Container::warmUp(Executor &&executor) const {
+        using clock = std::chrono::steady_clock;
+
+        auto registry = _registry.read();
+        auto nodes = _warmUpGraph(*registry);
+        std::size_t remaining = _warmUpReachable(nodes);
+
+        std::mutex mutex;
+        std::condition_variable finished;
+        std::vector<WarmUpTiming> timings;
+        std::exception_ptr error;
+        auto origin = clock::now();
+
+        auto build = [&](std::size_t i) {
+            auto start = clock::now();
+
+            try {
+                if (nodes[i].reg->state.load(std::memory_order_acquire) != _internals::Registration::State::Ready)
+                    _buildSingleton(*nodes[i].reg, nodes[i].id);
+            } catch (...) {
+                std::lock_guard lock(mutex);
+                if (!error)
+                    error = std::current_exception();
+            }
+
+            auto end = clock::now();
+            std::lock_guard lock(mutex);
+            timings.push_back({ utils::typeIndex(nodes[i].id), start - origin, end - start });
+        };
+
+        std::function<void(std::size_t)> run;
+        auto submit = [&executor, &run](std::size_t i) {
+            executor(std::function<void()>([&run, i]() { run(i); }));
+        };
+
+        run = [&](std::size_t i) {
+            build(i);
+            for (std::size_t dependent: nodes[i].dependents)
+                if (nodes[dependent].pending->fetch_sub(1, std::memory_order_acq_rel) == 1)
+                    submit(dependent);
+
+            std::lock_guard lock(mutex);
+            if (--remaining == 0)
+                finished.notify_all();
+        };
+
+        if (remaining != 0) {
+            std::vector<std::size_t> roots;
+
+            for (std::size_t i = 0; i < nodes.size(); ++i)
+                if (nodes[i].pending->load(std::memory_order_relaxed) == 0)
+                    roots.push_back(i);
+            for (std::size_t i: roots)
+                submit(i);
+
+            std::unique_lock lock(mutex);
+            finished.wait(lock, [&remaining]() { return remaining == 0; });
+        }
+
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+            if (nodes[i].pending->load(std::memory_order_relaxed) != 0)
+                build(i);
+
+        if (error)
+            std::rethrow_exception(error);
+        return timings;
+    }
+
+    /**
+    ** \brief Build every registered singleton, on the calling thread.
+    **
+    ** This is Container::warmUp(Executor &&) with an executor running tasks
+    ** immediately.
+    **
+    ** \return Construction time of each singleton built, in the order they
+    ** were built.
+    */
+    inline std::vector<WarmUpTiming> Container::warmUp() const {
+        return warmUp([](std::function<void()> const &task) { task(); });
+    }
+
+    /**
+    ** \brief Create a new lifetime scope.
+    **
+    ** Scoped types have to be requested through a scope, which keeps one
+    ** instance of each of them until it is destroyed. Creating a scope only
+    ** allocates one slot per scoped registration.
+    **
+    ** Scoped types registered after the scope was created cannot be
+    ** requested through it.
+    **
+    ** \return An empty scope.
+    */
+    inline Scope Container::createScope() const {
+        return Scope(*this, _registry.read()->scope_slots);
+    }
+
+    /**
+    ** \brief Compile a resolution plan for T.
+    **
+    ** The registrations needed to build T are walked once, and turned into a
+    ** flat list of the transients to build, dependencies first. Resolving T
+    ** through the returned plan runs that list in a loop, instead of
+    ** recursing through getInstance. Dependencies that are not transients,
+    ** or whose builder cannot be given its arguments, such as the ones
+    ** registered with addTransient, are requested to the container.
+    **
+    ** \see ResolutionPlan
+    **
+    ** \tparam T The type to resolve.
+    **
+    ** \return The plan.
+    */
+    template <class T>
+    inline ResolutionPlan<T> Container::compilePlan() const {
+        auto registry = _registry.read();
+
+        return ResolutionPlan<T>(*this, _compilePlan(*registry, utils::typeId<T>()));
+    }
+
+    /**
+    ** \internal
+    ** \brief Compile the resolution plan of a type.
+    **
+    ** The dependency graph is walked depth-first, with an explicit stack,
+    ** each step being emitted once its arguments are. A dependency already
+    ** on the stack would lead to a cycle: it's left to the container, which
+    ** reports it when the plan is run.
+    **
+    ** \param registry The registry snapshot to compile against.
+    ** \param id Dense identifier of the type.
+    **
+    ** \return The compiled plan, without any step if the type itself cannot
+    ** be built by a plan.
+    */
+    inline std::shared_ptr<_internals::CompiledPlan const> Container::_compilePlan(_internals::Registry const &registry, utils::type_id_t id) {
+        struct Pending {
+            utils::type_id_t id;
+            std::shared_ptr<builders::IBuilder> builder;
+            std::vector<utils::type_id_t> deps;
+            std::vector<std::size_t> args;
+        };
+
+        auto plan = std::make_shared<_internals::CompiledPlan>();
+        std::vector<Pending> stack;
+
+        auto open = [&registry, &stack](utils::type_id_t dep) {
+            auto *reg = _find(registry, dep);
+            std::vector<utils::type_id_t> deps;
+
+            if (!reg || !reg->typed || reg->lifetime != type_desc::Lifetime::Transient
+                    || !reg->builder->getArguments(deps))
+                return false;
+            for (auto const &pending: stack)
+                if (pending.id == dep)
+                    return false;
+            stack.push_back({ dep, reg->builder, std::move(deps), {} });
+            return true;
+        };
+
+        plan->generation = registry.generation;
+        if (!open(id))
+            return plan;
+
+        while (!stack.empty()) {
+            auto &top = stack.back();
+
+            if (top.args.size() < top.deps.size()) {
+                if (!open(top.deps[top.args.size()])) {
+                    stack.back().args.push_back(_internals::CompiledPlan::no_step);
+                    ++plan->boundaries;
+                }
+                continue;
+            }
+
+            plan->depth = std::max(plan->depth, stack.size());
+            plan->max_args = std::max(plan->max_args, top.args.size());
+            plan->steps.push_back({ std::move(top.builder), plan->args.size(), top.args.size() });
+            plan->args.insert(plan->args.end(), top.args.begin(), top.args.end());
+            stack.pop_back();
+            if (!stack.empty())
+                stack.back().args.push_back(plan->steps.size() - 1);
+        }
+        return plan;
+    }
+
+    /**
+    ** \internal
+    ** \brief Resolve T through a resolution plan, compiling it again first
+    ** if it's stale.
+    **
+    ** \param state The plan.
+    **
+    ** \return The instance.
+    */
+    template <class T>
+    inline std::shared_ptr<T> Container::_runPlan(_internals::PlanState &state) const {
+        auto registry = _registry.read();
+        auto plan = std::atomic_load(&state.compiled);
+
+        if (plan->generation != registry->generation) {
+            plan = _compilePlan(*registry, utils::typeId<T>());
+            std::atomic_store(&state.compiled, plan);
+            state.compilations.fetch_add(1, std::memory_order_relaxed);
+        }
+        state.runs.fetch_add(1, std::memory_order_relaxed);
+
+        if (plan->steps.empty())
+            return _getInstance<T>(*registry, utils::typeId<T>());
+        return std::static_pointer_cast<T>(_executePlan(*registry, *plan));
+    }
+
+    /**
+    ** \internal
+    ** \brief Run the steps of a resolution plan.
+    **
+    ** Every step is built with IBuilder::buildFrom, from the instances built
+    ** by the previous ones, and allocated as Container::getInstance would
+    ** allocate transients. Each instance is moved into the step using it.
+    ** The bookkeeping comes from a buffer on the stack, unless the plan is
+    ** large.
+    **
+    ** \param registry The registry snapshot the plan was compiled against.
+    ** \param plan The plan, which must have at least one step.
+    **
+    ** \return The instance built by the last step.
+    */
+    inline std::shared_ptr<void> Container::_executePlan(_internals::Registry const &registry, _internals::CompiledPlan const &plan) const {
+        std::byte buffer[1024];
+        std::pmr::monotonic_buffer_resource local(buffer, sizeof(buffer), _resource);
+        std::pmr::vector<std::shared_ptr<void>> instances(plan.steps.size(), &local);
+        std::pmr::vector<std::shared_ptr<void>> args(plan.max_args, &local);
+        auto *resource = _internals::currentArena();
+
+        if (!resource)
+            resource = registry.transient_resource;
+
+        for (std::size_t i = 0; i < plan.steps.size(); ++i) {
+            auto const &step = plan.steps[i];
+
+            for (std::size_t arg = 0; arg < step.arg_count; ++arg) {
+                std::size_t from = plan.args[step.first_arg + arg];
+
+                if (from == _internals::CompiledPlan::no_step)
+                    args[arg] = nullptr;
+                else
+                    args[arg] = std::move(instances[from]);
+            }
+            instances[i] = step.builder->buildFrom(*this, args.data(), resource);
+        }
+        return std::move(instances.back());
+    }
+
+    /**
+    ** \brief Get the usage statistics of the pool of a pooled type.
+    **
+    ** \tparam T The pooled type, as registered.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if the type is not pooled.
+    **
+    ** \return Hits, misses, idle instances and capacity of the pool.
+    */
+    template <class T>
+    inline builders::PoolStats Container::getPoolStats() const {
+        using Error = clonixin::exceptions::ContainerError;
+        auto registry = _registry.read();
+        auto *reg = _find(*registry, utils::typeId<T>());
+
+        if (!reg)
+            throw exceptions::ContainerException<Error::TypeNotFound>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::TypeNotFound] + typeid(T).name(),
+                    __FILE__, __LINE__
+                    );
+
+        auto const *pooled = dynamic_cast<builders::IPooledBuilder const *>(reg->builder.get());
+
+        if (reg->lifetime != type_desc::Lifetime::Pooled || !pooled)
+            throw exceptions::ContainerException<Error::BadLifetime>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + typeid(T).name() +
+                    ". Type is not pooled.",
+                    __FILE__, __LINE__
+                    );
+        return pooled->getPoolStats();
+    }
+
+    /**
+    ** \brief Get the builder of a transient or pooled type.
+    **
+    ** This lets callers building many instances of a type, such as
+    ** inject::Factory, skip the registry lookup on each of them. The builder
+    ** is the one registered when this function is called, and is kept alive
+    ** by the returned pointer even if the type is registered again.
+    **
+    ** \param id The dense identifier of the type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if the type is neither transient nor pooled.
+    **
+    ** \return The builder of the type.
+    */
+    inline std::shared_ptr<builders::IBuilder const> Container::getTransientBuilder(utils::type_id_t id) const {
+        using type_desc::Lifetime;
+        using Error = clonixin::exceptions::ContainerError;
+        auto registry = _registry.read();
+        auto const *reg = _find(*registry, id);
+
+        if (!reg)
+            throw exceptions::ContainerException<Error::TypeNotFound>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::TypeNotFound] + utils::typeIndex(id).name(),
+                    __FILE__, __LINE__
+                    );
+        if (reg->lifetime != Lifetime::Transient && reg->lifetime != Lifetime::Pooled)
+            throw exceptions::ContainerException<Error::BadLifetime>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                    ". Type is neither transient nor pooled.",
+                    __FILE__, __LINE__
+                    );
+        return std::shared_ptr<builders::IBuilder const>(registry->registrations[id], reg->builder.get());
+    }
+
+    /**
+    ** \internal
+    ** \brief Get the instance of a scoped type, from the scope bound to the
+    ** calling thread, building it if needed.
+    **
+    ** \param reg Registration of the scoped type.
+    ** \param id Dense identifier of the scoped type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::NoScope>
+    ** Thrown if no scope of this container is bound, or if the type was
+    ** registered after the scope was created.
+    **
+    ** \return The instance, as a shared_ptr wrapped in a std::any.
+    */
+    inline std::any Container::_getScoped(_internals::Registration const &reg, utils::type_id_t id) const {
+        using Error = clonixin::exceptions::ContainerError;
+        auto const *scope = _internals::currentScope();
+
+        if (!scope || scope->container != this || reg.scope_slot >= scope->size)
+            throw exceptions::ContainerException<Error::NoScope>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::NoScope] + utils::typeIndex(id).name(),
+                    __FILE__, __LINE__
+                    );
+
+        std::any &slot = scope->slots[reg.scope_slot];
+
+        if (!slot.has_value()) {
+            _internals::ResolutionFrame frame(this, id);
+            _internals::ArenaBinding no_arena(nullptr);
+            slot = reg.builder->buildPtr(*this);
+        }
+        return slot;
+    }
+
+    /**
+    ** \internal
+    ** \brief Build the dependency graph of the singletons not built yet.
+    **
+    ** Singleton members of collections get their own node, as they are not
+    ** reachable through their type. The dependencies of each singleton are
+    ** followed through transients, until singletons are found. Unregistered
+    ** dependencies are left for the build to report.
+    **
+    ** \param registry The registry snapshot to look into.
+    **
+    ** \return The singletons, with their dependents and their number of
+    ** dependencies.
+    */
+    inline std::vector<_internals::WarmUpNode> Container::_warmUpGraph(_internals::Registry const &registry) {
+        using type_desc::Lifetime;
+        constexpr std::size_t none = -1;
+        auto const &registrations = registry.registrations;
+        auto const &collections = registry.collections;
+        auto pending = [](_internals::Registration const *reg) {
+            return reg && reg->builder && reg->lifetime == Lifetime::Singleton
+                && reg->state.load(std::memory_order_acquire) != _internals::Registration::State::Ready;
+        };
+
+        std::vector<_internals::WarmUpNode> nodes;
+        std::vector<std::size_t> position(registrations.size(), none);
+
+        for (utils::type_id_t id = 0; id < registrations.size(); ++id) {
+            if (pending(registrations[id].get())) {
+                position[id] = nodes.size();
+                nodes.push_back({ id, registrations[id].get(), {} });
+            }
+        }
+
+        for (utils::type_id_t id = 0; id < collections.size(); ++id) {
+            if (!collections[id])
+                continue;
+            for (auto const &member: collections[id]->members)
+                if (member != registrations[id] && pending(member.get()))
+                    nodes.push_back({ id, member.get(), {} });
+        }
+
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            std::vector<bool> seen(registrations.size(), false);
+            std::vector<utils::type_id_t> todo = nodes[i].reg->builder->getDependencies();
+
+            while (!todo.empty()) {
+                utils::type_id_t dep = todo.back();
+                todo.pop_back();
+
+                if (dep >= registrations.size() || seen[dep] || !registrations[dep])
+                    continue;
+                seen[dep] = true;
+
+                auto const *reg = registrations[dep].get();
+
+                if (position[dep] != none) {
+                    nodes[position[dep]].dependents.push_back(i);
+                    nodes[i].pending->fetch_add(1, std::memory_order_relaxed);
+                } else if (reg->lifetime != Lifetime::Singleton && reg->builder) {
+                    auto more = reg->builder->getDependencies();
+                    todo.insert(todo.end(), more.begin(), more.end());
+                }
+            }
+        }
+        return nodes;
+    }
+
+    /**
+    ** \internal
+    ** \brief Count the singletons a topological sort can reach, that is
+    ** those not part of, nor depending on, a dependency cycle.
+    */
+    inline std::size_t Container::_warmUpReachable(std::vector<_internals::WarmUpNode> const &nodes) {
+        std::vector<std::size_t> pending;
+        std::vector<std::size_t> ready;
+        std::size_t reached = 0;
+
+        for (std::size_t i = 0; i < nodes.size(); ++i) {
+            pending.push_back(nodes[i].pending->load(std::memory_order_relaxed));
+            if (pending.back() == 0)
+                ready.push_back(i);
+        }
+
+        while (!ready.empty()) {
+            std::size_t i = ready.back();
+            ready.pop_back();
+            ++reached;
+
+            for (std::size_t dependent: nodes[i].dependents)
+                if (--pending[dependent] == 0)
+                    ready.push_back(dependent);
+        }
+        return reached;
+    }
+
+    /**
+    ** \internal
+    ** \brief Find the dense identifier of a registered type, in a sealed
+    ** container.
+    **
+    ** \param registry The registry snapshot to look into.
+    ** \param t The type to look for.
+    **
+    ** \return The dense identifier of t, or an empty optional if the type is
+    ** not registered.
+    */
+    inline std::optional<utils::type_id_t> Container::_findSealed(_internals::Registry const &registry, std::type_index t) noexcept {
+        auto const &index = registry.sealed_index;
+        std::size_t hash = t.hash_code();
+        auto it = std::lower_bound(index.begin(), index.end(), hash,
+                [](auto const &entry, std::size_t h) { return entry.hash < h; });
+
+        for (; it != index.end() && it->hash == hash; ++it)
+            if (it->type == t)
+                return it->id;
+        return std::nullopt;
+    }
+
+    /**
+    ** \brief Get a given instance wrapped in a shared_ptr.
+    **
+    ** This function build or retrieved a given instance, building every
+    ** needed types in the process, then return a std::shared_ptr to the
+    ** instances, by wrapping it in a std::any.
+    **
+    ** The type is mapped to its dense identifier once, then resolution
+    ** continues as for getInstance(tag::container::ptr_t, utils::type_id_t).
+    **
+    ** \param t A std::type_index, that represent the type to be retrieved.
+    **
+    ** \return If the instance could be built, it's returned. Otherwise a
+    ** std::runtime_error will be thrown.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if an invalid lifetime is found.
+    **
+    */
+    inline std::any Container::getInstance(tag::container::ptr_t, std::type_index t) const {
+        auto registry = _registry.read();
+        auto id = registry->sealed ? _findSealed(*registry, t) : utils::findTypeId(t);
+
+        if (!id)
+            return _typeNotFound(tag::container::ptr, t);
+        return getInstance(tag::container::ptr, *id);
+    }
+
+    /**
+    ** \brief Get a given instance, as a rvalue..
+    **
+    ** This function build or retrieved a given instance, building every
+    ** needed types in the process, then return it's value wrapped in a std::any.
+    **
+    ** The type is mapped to its dense identifier once, then resolution
+    ** continues as for getInstance(tag::container::rref_t, utils::type_id_t).
+    **
+    ** \param t A std::type_index, that represent the type to be retrieved.
+    **
+    ** \return If the instance could be built, it's returned. Otherwise a
+    ** std::runtime_error will be thrown.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if an invalid lifetime is found.
+    **
+    */
+    inline std::any Container::getInstance(tag::container::rref_t, std::type_index t) const {
+        auto registry = _registry.read();
+        auto id = registry->sealed ? _findSealed(*registry, t) : utils::findTypeId(t);
+
+        if (!id)
+            return _typeNotFound(tag::container::rref, t);
+        return getInstance(tag::container::rref, *id);
+    }
+
+    /**
+    ** \brief Get a given instance wrapped in a shared_ptr.
+    **
+    ** This function build or retrieved a given instance, building every
+    ** needed types in the process, then return a std::shared_ptr to the
+    ** instances, by wrapping it in a std::any.
+    **
+    ** \param id The dense identifier of the type to be retrieved.
+    **
+    ** \return If the instance could be built, it's returned. Otherwise a
+    ** std::runtime_error will be thrown.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if an invalid lifetime is found.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if building the type requires building it again.
+    **
+    */
+    inline std::any Container::getInstance(tag::container::ptr_t, utils::type_id_t id) const {
+        auto registry = _registry.read();
+        auto *reg = _find(*registry, id);
+
+        if (!reg)
+            return _typeNotFound(tag::container::ptr, utils::typeIndex(id));
+        return _getAny(*registry, *reg, id);
+    }
+
+    /**
+    ** \internal
+    ** \brief Get the instance of a given registration, wrapped in a
+    ** shared_ptr, itself wrapped in a std::any.
+    **
+    ** \param registry The registry snapshot reg was found in.
+    ** \param reg The registration to get an instance of.
+    ** \param id The dense identifier of the registered type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if an invalid lifetime is found.
+    */
+    inline std::any Container::_getAny(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const {
+        using type_desc::Lifetime;
+        using Error = clonixin::exceptions::ContainerError;
+
+        switch (reg.lifetime) {
+            case Lifetime::Transient: {
+                _internals::ResolutionFrame frame(this, id);
+
+                if (auto *arena = _internals::currentArena())
+                    return reg.builder->allocatePtr(*this, arena);
+                if (registry.transient_resource)
+                    return reg.builder->allocatePtr(*this, registry.transient_resource);
+                return reg.builder->buildPtr(*this);
+            }
+            case Lifetime::Pooled: {
+                _internals::ResolutionFrame frame(this, id);
+
+                return reg.builder->buildPtr(*this);
+            }
+            case Lifetime::Singleton:
+                if (reg.state.load(std::memory_order_acquire) != _internals::Registration::State::Ready)
+                    _buildSingleton(reg, id);
+                return reg.instance;
+            case Lifetime::Scoped:
+                return _getScoped(reg, id);
+            case Lifetime::Cached:
+                return _getCached(reg, id);
+            default: //GCOV_EXCL_START
+            throw exceptions::ContainerException<Error::BadLifetime>(
+                exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name(),
+                __FILE__, __LINE__
+            );
+        } //GCOV_EXCL_STOP
+    }
+
+    /**
+    ** \brief Get a given instance, as a rvalue..
+    **
+    ** This function build or retrieved a given instance, building every
+    ** needed types in the process, then return it's value wrapped in a std::any.
+    **
+    ** \param id The dense identifier of the type to be retrieved.
+    **
+    ** \return If the instance could be built, it's returned. Otherwise a
+    ** std::runtime_error will be thrown.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if an invalid lifetime is found.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if building the type requires building it again.
+    **
+    */
+    inline std::any Container::getInstance(tag::container::rref_t, utils::type_id_t id) const {
+        using type_desc::Lifetime;
+        using Error = clonixin::exceptions::ContainerError;
+        auto registry = _registry.read();
+        auto *reg = _find(*registry, id);
+
+        if (!reg)
+            return _typeNotFound(tag::container::rref, utils::typeIndex(id));
+
+        switch (reg->lifetime) {
+            case Lifetime::Transient: {
+                _internals::ResolutionFrame frame(this, id);
+
+                return reg->builder->buildVal(*this);
+            }
+            case Lifetime::Singleton:
+                throw exceptions::ContainerException<Error::BadLifetime>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                        ". Cannot return a singleton using move semantics.",
+                        __FILE__, __LINE__
+                        );
+            case Lifetime::Scoped:
+                throw exceptions::ContainerException<Error::BadLifetime>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                        ". Cannot return a scoped instance using move semantics.",
+                        __FILE__, __LINE__
+                        );
+            case Lifetime::Cached:
+                throw exceptions::ContainerException<Error::BadLifetime>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                        ". Cannot return a cached instance using move semantics.",
+                        __FILE__, __LINE__
+                        );
+            case Lifetime::Pooled:
+                throw exceptions::ContainerException<Error::BadLifetime>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                        ". Cannot return a pooled instance using move semantics.",
+                        __FILE__, __LINE__
+                        );
+            default: //GCOV_EXCL_START
+            throw exceptions::ContainerException<Error::BadLifetime>(
+                exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name(),
+                __FILE__, __LINE__
+            );
+        } //GCOV_EXCL_STOP
+    }
+
+    /**
+    ** \brief Get a given instance as a shared_ptr.
+    **
+    ** This function build or retrieved a given instance, building every
+    ** needed types in the process, then return a std::shared_ptr to the
+    ** instances.
     **
     ** This function build or retrieved a given instance, building every
     ** needed types in the process, then return the instances, by wrapping it
@@ -717,14 +2220,166 @@ namespace clonixin {
     ** \return If the instance could be built, it's returned. Otherwise a
     ** std::runtime_error will be thrown.
     **
+    ** Types registered with addType or addInstance are resolved as a
+    ** std::shared_ptr<void> to T, without going through std::any: singletons
+    ** cost an atomic load and a single reference count increment. Other
+    ** registrations, and scoped types, go through the type-erased
+    ** getInstance(tag::container::ptr_t, utils::type_id_t).
+    **
     ** \throw std::runtime_error If the type is not found, or if it's lifetime is an improper
     ** value, the function throws an std::runtime_error.
     */
     template <typename T>
     inline std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> Container::getInstance() const {
-        std::type_index idx = typeid(T);
+        auto registry = _registry.read();
+
+        return _getInstance<T>(*registry, utils::typeId<T>());
+    }
+
+    /**
+    ** \brief Get the instance of T registered under a key, as a shared_ptr.
+    **
+    ** This is getInstance<T>(), for the registration made with
+    ** addType(tag::container::key_t<K>) or
+    ** addInstance(std::unique_ptr<T> &&, tag::container::key_t<K>). The
+    ** unkeyed registration of T, if any, is not used.
+    **
+    ** \tparam T The type of the instance to be returned.
+    ** \tparam K The hash of the key.
+    **
+    ** \return The instance.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if T has not been registered under this key.
+    */
+    template <class T, utils::key_hash_t K>
+    inline std::shared_ptr<T> Container::getInstance(tag::container::key_t<K>) const {
+        auto registry = _registry.read();
+
+        return _getInstance<T>(*registry, utils::keyedTypeId<T, K>());
+    }
+
+    /**
+    ** \brief Get several instances at once, as shared_ptrs.
+    **
+    ** This is getInstance<T>() for each of Ts, with a single registry
+    ** snapshot for Ts themselves: the snapshot is only acquired once, and
+    ** each of Ts is looked up in it, through a dispatch expanded at compile
+    ** time for each of them. Their dependencies are still requested through
+    ** getInstance, each reading the current snapshot. Instances are built
+    ** from left to right.
+    **
+    ** \tparam Ts The types of the instances to be returned.
+    **
+    ** \return A std::tuple holding a std::shared_ptr to each instance, in
+    ** the order of Ts.
+    **
+    ** \throw Whatever getInstance<T>() throws for any of Ts.
+    */
+    template <class... Ts>
+    inline std::tuple<std::shared_ptr<Ts>...> Container::getInstances() const {
+        static_assert(std::conjunction_v<std::negation<std::is_reference<Ts>>...>,
+                "Instances are returned as shared_ptr, Ts cannot be references.");
+        auto registry = _registry.read();
+
+        return std::tuple<std::shared_ptr<Ts>...>{ _getInstance<Ts>(*registry, utils::typeId<Ts>())... };
+    }
+
+    /**
+    ** \internal
+    ** \brief Get a given instance as a shared_ptr, from a registry snapshot.
+    **
+    ** \param registry The snapshot to resolve T against.
+    ** \param id The dense identifier T is registered as.
+    **
+    ** \return The instance.
+    */
+    template <class T>
+    inline std::shared_ptr<T> Container::_getInstance(_internals::Registry const &registry, utils::type_id_t id) const {
+        auto *reg = _find(registry, id);
+
+        if (reg && reg->typed)
+            return _getMember<T>(registry, *reg, id);
+        return std::any_cast<std::shared_ptr<T>>(getInstance(tag::container::ptr, id));
+    }
+
+    /**
+    ** \internal
+    ** \brief Get the instance of a given registration of T, as a shared_ptr.
+    **
+    ** Typed registrations skip std::any, as getInstance<T>() does. Others go
+    ** through _getAny.
+    **
+    ** \param registry The registry snapshot reg was found in.
+    ** \param reg A registration of T.
+    ** \param id The dense identifier of T.
+    **
+    ** \return The instance.
+    */
+    template <class T>
+    inline std::shared_ptr<T> Container::_getMember(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const {
+        using type_desc::Lifetime;
+
+        if (reg.typed) {
+            if (reg.lifetime == Lifetime::Singleton) {
+                if (reg.state.load(std::memory_order_acquire) != _internals::Registration::State::Ready)
+                    _buildSingleton(reg, id);
+                return std::static_pointer_cast<T>(reg.shared);
+            }
+            if (auto ptr = _getShared(registry, reg, id))
+                return std::static_pointer_cast<T>(ptr);
+        }
+        return std::any_cast<std::shared_ptr<T>>(_getAny(registry, reg, id));
+    }
+
+    /**
+    ** \brief Get an instance of every registration of T, as shared_ptrs.
+    **
+    ** Types registered several times, with the append duplicate tag, return
+    ** one instance per registration, in registration order. Other types
+    ** return their single instance, and types that were not registered an
+    ** empty vector.
+    **
+    ** When every registration of T is a singleton, the instances are
+    ** resolved on the first call only, and later calls copy the prebuilt
+    ** array.
+    **
+    ** \tparam T The registered type.
+    **
+    ** \return The instances, in a contiguous vector.
+    **
+    ** \throw Whatever building an instance throws.
+    */
+    template <class T>
+    inline std::vector<std::shared_ptr<T>> Container::getAll() const {
+        using All = std::vector<std::shared_ptr<T>>;
+        auto id = utils::typeId<T>();
+        auto registry = _registry.read();
+        auto const &collections = registry->collections;
+        auto *collection = id < collections.size() ? collections[id].get() : nullptr;
 
-        return std::any_cast<std::shared_ptr<T>>(getInstance(tag::container::ptr, idx));
+        if (!collection) {
+            if (auto *reg = _find(*registry, id))
+                return All{ _getMember<T>(*registry, *reg, id) };
+            return All{};
+        }
+
+        if (collection->singletons) {
+            if (auto prebuilt = std::atomic_load_explicit(&collection->prebuilt, std::memory_order_acquire))
+                return *std::static_pointer_cast<All const>(prebuilt);
+        }
+
+        All all;
+
+        all.reserve(collection->members.size());
+        for (auto const &member: collection->members)
+            all.push_back(_getMember<T>(*registry, *member, id));
+
+        if (collection->singletons)
+            std::atomic_store_explicit(&collection->prebuilt,
+                    std::shared_ptr<void>(std::allocate_shared<All>(std::pmr::polymorphic_allocator<All>(_resource), all)),
+                    std::memory_order_release);
+        return all;
     }
 
     /**
@@ -747,9 +2402,343 @@ namespace clonixin {
     */
     template <class T>
     inline std::enable_if_t<std::is_rvalue_reference_v<T>, T &&> Container::getInstance() const {
-        std::type_index idx = typeid(T);
+        return std::any_cast<T &&>(getInstance(tag::container::rref, utils::typeId<T>()));
+    }
+
+    /**
+    ** \brief Build a transient instance, and return it by value.
+    **
+    ** Unlike getInstance<T &&>(), which returns a reference into a std::any
+    ** destroyed at the end of the full expression, the instance is returned
+    ** as a prvalue. For non-polymorphic types registered with addType, it's
+    ** built by builders::ITypedBuilder::buildValue, directly where the
+    ** caller wants it: there is no std::any, no allocation and no move, so T
+    ** does not even need to be movable.
+    **
+    ** Other transients, such as those registered with a custom builder, go
+    ** through getInstance(tag::container::rref_t, utils::type_id_t), and are
+    ** moved out of the std::any. If T cannot be moved, nothing is built.
+    **
+    ** This is what rvalue reference constructor arguments use.
+    **
+    ** \tparam T The type of the instance to be returned.
+    **
+    ** \return The newly built instance.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if the type has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if the type is not transient.
+    ** \throw exceptions::BuilderException<exceptions::BuilderError::RvalueUnsupported>
+    ** Thrown if the type cannot be built by value.
+    */
+    template <class T>
+    inline T Container::resolve() const {
+        using type_desc::Lifetime;
+        using Error = exceptions::BuilderError;
+        static_assert(!std::is_reference_v<T>, "Cannot resolve a reference type.");
+        auto id = utils::typeId<T>();
+
+        {
+            auto registry = _registry.read();
+            auto *reg = _find(*registry, id);
+
+            if (reg && reg->value_builder && reg->lifetime == Lifetime::Transient) {
+                _internals::ResolutionFrame frame(this, id);
+
+                return static_cast<builders::ITypedBuilder<T> const *>(reg->value_builder)->buildValue(*this);
+            }
+
+            if constexpr (!std::is_move_constructible_v<T>) {
+                using LifetimeError = exceptions::ContainerError;
+
+                if (!reg)
+                    (void)_typeNotFound(tag::container::rref, utils::typeIndex(id));
+                else if (reg->lifetime != Lifetime::Transient)
+                    throw exceptions::ContainerException<LifetimeError::BadLifetime>(
+                            exceptions::CONTAINER_ERROR_DESC[(size_t)LifetimeError::BadLifetime] + typeid(T).name() +
+                            ". Type is not transient.",
+                            __FILE__, __LINE__
+                            );
+            }
+        }
+
+        if constexpr (std::is_move_constructible_v<T>) {
+            return std::any_cast<T &&>(getInstance(tag::container::rref, id));
+        } else {
+            throw exceptions::BuilderException<Error::RvalueUnsupported>(
+                    exceptions::BUILDER_ERROR_DESC[(size_t)Error::RvalueUnsupported] + typeid(T).name(),
+                    __FILE__, __LINE__
+                    );
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Build a singleton, exactly once.
+    **
+    ** This is the slow path of singleton resolution. The first thread to get
+    ** here marks the registration as being built, and builds it without
+    ** holding any lock, so that the builder can request other types. Other
+    ** threads wait until it's done. If the build fails, the registration is
+    ** reset, and one of the waiting threads tries again.
+    **
+    ** Before waiting, the chain of threads waiting for each other is
+    ** followed. If it leads back to the current thread, waiting would never
+    ** end, and an exception is thrown instead. A builder requesting its own
+    ** type is reported as a circular dependency.
+    **
+    ** \param reg Registration of the singleton.
+    ** \param id Dense identifier of the singleton.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if the singleton needs itself to be built.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::Deadlock>
+    ** Thrown if waiting for the singleton would deadlock.
+    */
+    inline void Container::_buildSingleton(_internals::Registration &reg, utils::type_id_t id) const {
+        using State = _internals::Registration::State;
+        auto self = std::this_thread::get_id();
+        std::unique_lock lock(_init_mutex);
+
+        while (true) {
+            switch (reg.state.load(std::memory_order_relaxed)) {
+                case State::Ready:
+                    return;
+                case State::Empty: {
+                    reg.state.store(State::Building, std::memory_order_relaxed);
+                    reg.owner = self;
+                    lock.unlock();
+
+                    std::any instance;
+                    std::shared_ptr<void> shared;
+                    try {
+                        _internals::ResolutionFrame frame(this, id);
+                        _internals::ArenaBinding no_arena(nullptr);
+                        _internals::ScopeBinding no_scope(nullptr);
+                        auto *resource = _registry.read()->singleton_resource;
+
+                        if (reg.typed) {
+                            shared = resource ? reg.builder->allocateShared(*this, resource) : reg.builder->buildShared(*this);
+                            instance = reg.builder->wrapShared(shared);
+                        } else {
+                            instance = resource ? reg.builder->allocatePtr(*this, resource) : reg.builder->buildPtr(*this);
+                        }
+                    } catch (...) {
+                        lock.lock();
+                        reg.owner = std::thread::id();
+                        reg.state.store(State::Empty, std::memory_order_relaxed);
+                        _init_cv.notify_all();
+                        throw;
+                    }
+
+                    lock.lock();
+                    reg.instance = std::move(instance);
+                    reg.shared = std::move(shared);
+                    reg.owner = std::thread::id();
+                    reg.state.store(State::Ready, std::memory_order_release);
+                    _init_cv.notify_all();
+                    return;
+                }
+                case State::Building:
+                    _waitForBuild(lock, reg, id);
+                    break;
+            }
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Get the instance of a cached type, building it if there is none
+    ** alive.
+    **
+    ** The fast path only locks the registration, to read its weak reference.
+    ** If the instance is gone, it is built again as a singleton would be:
+    ** one thread builds it, without holding any lock, while the others wait
+    ** for it.
+    **
+    ** \param reg Registration of the cached type.
+    ** \param id Dense identifier of the cached type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if the instance needs itself to be built.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::Deadlock>
+    ** Thrown if waiting for the instance would deadlock.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if the builder does not support IBuilder::buildShared.
+    **
+    ** \return The instance, as a shared_ptr wrapped in a std::any.
+    */
+    inline std::any Container::_getCached(_internals::Registration &reg, utils::type_id_t id) const {
+        return reg.builder->wrapShared(_getCachedShared(reg, id));
+    }
+
+    /**
+    ** \internal
+    ** \brief Get the instance of a cached type, as returned by
+    ** IBuilder::buildShared, building it if there is none alive.
+    **
+    ** The instance is looked up again once _init_mutex is held, as another
+    ** thread may have built and published one in between.
+    **
+    ** \param reg Registration of the cached type.
+    ** \param id Dense identifier of the cached type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if the instance needs itself to be built.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::Deadlock>
+    ** Thrown if waiting for the instance would deadlock.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if the builder does not support IBuilder::buildShared.
+    **
+    ** \return The instance.
+    */
+    inline std::shared_ptr<void> Container::_getCachedShared(_internals::Registration &reg, utils::type_id_t id) const {
+        using State = _internals::Registration::State;
+        using Error = clonixin::exceptions::ContainerError;
+        auto &cached = *reg.cached;
+        std::shared_ptr<void> instance;
+
+        {
+            std::lock_guard guard(cached.mutex);
+            instance = cached.weak.lock();
+        }
+        if (instance)
+            return instance;
+
+        std::unique_lock lock(_init_mutex);
+
+        while (true) {
+            {
+                std::lock_guard guard(cached.mutex);
+                instance = cached.weak.lock();
+            }
+            if (instance || reg.state.load(std::memory_order_relaxed) != State::Building)
+                break;
+            _waitForBuild(lock, reg, id);
+        }
+        if (instance)
+            return instance;
+
+        reg.state.store(State::Building, std::memory_order_relaxed);
+        reg.owner = std::this_thread::get_id();
+        lock.unlock();
+
+        try {
+            _internals::ResolutionFrame frame(this, id);
+            _internals::ArenaBinding no_arena(nullptr);
+            _internals::ScopeBinding no_scope(nullptr);
+            instance = reg.builder->buildShared(*this);
+        } catch (...) {
+            lock.lock();
+            reg.owner = std::thread::id();
+            reg.state.store(State::Empty, std::memory_order_relaxed);
+            _init_cv.notify_all();
+            throw;
+        }
+
+        lock.lock();
+        if (instance) {
+            std::lock_guard guard(cached.mutex);
+            cached.weak = instance;
+        }
+        reg.owner = std::thread::id();
+        reg.state.store(State::Empty, std::memory_order_relaxed);
+        _init_cv.notify_all();
+        lock.unlock();
+
+        if (!instance)
+            throw exceptions::ContainerException<Error::BadLifetime>(
+                    exceptions::CONTAINER_ERROR_DESC[(size_t)Error::BadLifetime] + utils::typeIndex(id).name() +
+                    ". Builder cannot build cached instances.",
+                    __FILE__, __LINE__
+                    );
+        return instance;
+    }
+
+    /**
+    ** \internal
+    ** \brief Get an instance of a typed registration, other than a
+    ** singleton, as a std::shared_ptr<void> to the registered type.
+    **
+    ** This is the typed counterpart of getInstance(tag::container::ptr_t,
+    ** utils::type_id_t), for the lifetimes that can skip std::any. Scoped
+    ** types, whose instances are kept in std::any by scopes, are left to it.
+    **
+    ** \param registry The registry snapshot reg was found in.
+    ** \param reg Registration of the type, which must be typed.
+    ** \param id Dense identifier of the type.
+    **
+    ** \return The instance, or an empty pointer if getInstance has to be
+    ** used instead.
+    */
+    inline std::shared_ptr<void> Container::_getShared(_internals::Registry const &registry, _internals::Registration &reg, utils::type_id_t id) const {
+        using type_desc::Lifetime;
+
+        switch (reg.lifetime) {
+            case Lifetime::Transient: {
+                _internals::ResolutionFrame frame(this, id);
+
+                if (auto *arena = _internals::currentArena())
+                    return reg.builder->allocateShared(*this, arena);
+                if (registry.transient_resource)
+                    return reg.builder->allocateShared(*this, registry.transient_resource);
+                return reg.builder->buildShared(*this);
+            }
+            case Lifetime::Pooled: {
+                _internals::ResolutionFrame frame(this, id);
+
+                return reg.builder->buildShared(*this);
+            }
+            case Lifetime::Cached:
+                return _getCachedShared(reg, id);
+            default:
+                return nullptr;
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Wait for another thread to finish building an instance.
+    **
+    ** Before waiting, the chain of threads waiting for each other is
+    ** followed. If it leads back to the current thread, waiting would never
+    ** end, and an exception is thrown instead. When the current thread is
+    ** itself building the instance, the chain of types it is building is
+    ** reported as a circular dependency.
+    **
+    ** \param lock A lock on the initialization mutex.
+    ** \param reg Registration of the instance being built.
+    ** \param id Dense identifier of the instance being built.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if the current thread is building the instance.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::Deadlock>
+    ** Thrown if waiting would deadlock.
+    */
+    inline void Container::_waitForBuild(std::unique_lock<std::mutex> &lock, _internals::Registration const &reg, utils::type_id_t id) const {
+        using Error = clonixin::exceptions::ContainerError;
+        auto self = std::this_thread::get_id();
+
+        if (reg.owner == self)
+            _internals::resolutionStack().check(this, id);
+
+        for (auto owner = reg.owner;;) {
+            if (owner == self)
+                throw exceptions::ContainerException<Error::Deadlock>(
+                        exceptions::CONTAINER_ERROR_DESC[(size_t)Error::Deadlock] + utils::typeIndex(id).name(),
+                        __FILE__, __LINE__
+                        );
+
+            auto it = _waiting.find(owner);
+            if (it == _waiting.end())
+                break;
+            owner = it->second->owner;
+        }
 
-        return std::any_cast<T &&>(getInstance(tag::container::rref, idx));
+        _waiting[self] = &reg;
+        _init_cv.wait(lock);
+        _waiting.erase(self);
     }
 
     inline std::any Container::_typeNotFound(tag::container::ptr_t, std::type_index t) const {
@@ -0,0 +1,264 @@
+/**
+** \file Registration.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 10:12
+** \date Last update: 2026-10-18 00:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_Registration_hpp__
+#define containers_Registration_hpp__
+
+#include <any>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+#include "type_desc/Lifetime.hpp"
+#include "utils/TypeId.hpp"
+
+namespace clonixin::builders {
+    class IBuilder;
+}
+
+namespace clonixin::_internals {
+    /**
+    ** \internal
+    ** \brief Initialization state of a cached instance.
+    */
+    enum class InitState : int {
+        Empty,
+        Building,
+        Ready
+    };
+
+    /**
+    ** \internal
+    ** \brief Movable std::atomic<InitState>.
+    **
+    ** Registrations are only moved while registering types, which is never
+    ** done concurrently with a resolution, so the state is moved without
+    ** synchronization.
+    */
+    struct AtomicInitState : std::atomic<InitState> {
+        AtomicInitState() noexcept : std::atomic<InitState>(InitState::Empty) {}
+        AtomicInitState(AtomicInitState &&oth) noexcept
+        : std::atomic<InitState>(oth.load(std::memory_order_relaxed)) {}
+        AtomicInitState &operator=(AtomicInitState &&oth) noexcept {
+            store(oth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            return *this;
+        }
+    };
+
+    /**
+    ** \internal
+    ** \brief Weak reference to the instance of a cached type.
+    */
+    struct CachedInstance {
+        /**
+        ** \brief Protects weak, which is read on every request.
+        */
+        std::mutex mutex;
+
+        /**
+        ** \brief The current instance, as returned by IBuilder::buildShared.
+        */
+        std::weak_ptr<void> weak;
+    };
+
+    /**
+    ** \internal
+    ** \brief Everything the container knows about a registered type.
+    **
+    ** Lifetime, builder and cached instance used to live in three separate
+    ** maps. Keeping them together means a resolution only has to find one
+    ** record.
+    */
+    struct Registration {
+        using State = InitState;
+
+        /**
+        ** \brief Lifetime of the registered type.
+        */
+        type_desc::Lifetime lifetime = type_desc::Lifetime::Transient;
+
+        /**
+        ** \brief Builder used to create instances. Empty for instances
+        ** registered with Container::addInstance.
+        **
+        ** Shared, so that builders made by the container can be allocated,
+        ** along with their control block, from its memory resource.
+        */
+        std::shared_ptr<builders::IBuilder> builder;
+
+        /**
+        ** \brief Whether instances can be handled as a std::shared_ptr<void>
+        ** to the registered type: builder->buildShared returns such
+        ** pointers, and shared holds the singleton instance.
+        **
+        ** Registrations are indexed by the id of that type, so
+        ** getInstance<T> can cast them back without going through std::any.
+        ** Only set when the builder is known, as for addType and addInstance.
+        */
+        bool typed = false;
+
+        /**
+        ** \brief The builder, as a builders::ITypedBuilder of the registered
+        ** type, if it is one. Used by Container::resolve.
+        */
+        void const *value_builder = nullptr;
+
+        /**
+        ** \brief Cached instance, for singletons. Only written while state is
+        ** not Ready.
+        */
+        std::any instance;
+
+        /**
+        ** \brief Cached instance, for typed singletons. Written along with
+        ** instance.
+        */
+        std::shared_ptr<void> shared;
+
+        /**
+        ** \brief Initialization state of instance. Threads seeing Ready, with
+        ** an acquire load, can read instance without locking.
+        */
+        AtomicInitState state;
+
+        /**
+        ** \brief Thread building the instance, while state is Building.
+        */
+        std::thread::id owner;
+
+        /**
+        ** \brief Slot of the instance in scopes, for scoped types.
+        */
+        std::size_t scope_slot = 0;
+
+        /**
+        ** \brief Current instance, for cached types.
+        */
+        std::shared_ptr<CachedInstance> cached;
+    };
+
+    /**
+    ** \internal
+    ** \brief Every registration of a type registered more than once, with
+    ** the append duplicate tag.
+    **
+    ** Collections are never modified once published: appending a
+    ** registration publishes a new collection.
+    */
+    struct Collection {
+        explicit Collection(std::pmr::memory_resource *resource) : members(resource) {}
+
+        /**
+        ** \brief Registrations, in registration order.
+        */
+        std::pmr::vector<std::shared_ptr<Registration>> members;
+
+        /**
+        ** \brief Whether every member is a singleton, so that the
+        ** instances can be resolved once and kept in prebuilt.
+        */
+        bool singletons = false;
+
+        /**
+        ** \brief Instances of every member, as a std::vector of
+        ** std::shared_ptr to the registered type, once resolved. Accessed
+        ** with the atomic shared_ptr functions.
+        */
+        std::shared_ptr<void> prebuilt;
+    };
+
+    /**
+    ** \internal
+    ** \brief Entry of the lookup table built when sealing a container.
+    **
+    ** Sealed containers keep these sorted by hash, so that the type-erased
+    ** getInstance functions can find a type with a binary search, without
+    ** going through the process-wide type id registry.
+    */
+    struct SealedEntry {
+        std::size_t hash;
+        std::type_index type;
+        utils::type_id_t id;
+    };
+
+    /**
+    ** \internal
+    ** \brief Snapshot of every registration of a container.
+    **
+    ** Snapshots are never modified once published: registering a type copies
+    ** the current one, and publishes the copy. Registrations themselves are
+    ** shared between snapshots, so that a singleton built through one of them
+    ** is seen by the next ones.
+    **
+    ** Snapshots are allocator-aware, so that their tables come from the
+    ** memory resource of the container.
+    */
+    struct Registry {
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        explicit Registry(allocator_type alloc = {}) : registrations(alloc), collections(alloc), sealed_index(alloc) {}
+        Registry(Registry const &oth) = default;
+        Registry(Registry const &oth, allocator_type alloc)
+        : registrations(oth.registrations, alloc), collections(oth.collections, alloc),
+        sealed_index(oth.sealed_index, alloc), sealed(oth.sealed), generation(oth.generation),
+        scope_slots(oth.scope_slots), singleton_resource(oth.singleton_resource),
+        transient_resource(oth.transient_resource) {}
+
+        /**
+        ** \brief Registrations, indexed by dense type id.
+        */
+        std::pmr::vector<std::shared_ptr<Registration>> registrations;
+
+        /**
+        ** \brief Collections, indexed by dense type id. Only set for types
+        ** registered with the append duplicate tag.
+        */
+        std::pmr::vector<std::shared_ptr<Collection>> collections;
+
+        /**
+        ** \brief Lookup table of sealed containers, sorted by hash.
+        */
+        std::pmr::vector<SealedEntry> sealed_index;
+
+        /**
+        ** \brief Whether the container has been sealed.
+        */
+        bool sealed = false;
+
+        /**
+        ** \brief Number of registrations stored so far. Resolution plans
+        ** compiled against another generation are compiled again.
+        */
+        std::size_t generation = 0;
+
+        /**
+        ** \brief Number of slots needed by a scope.
+        */
+        std::size_t scope_slots = 0;
+
+        /**
+        ** \brief Resource singletons, and the control block of instances,
+        ** are allocated from. Null for the global heap.
+        */
+        std::pmr::memory_resource *singleton_resource = nullptr;
+
+        /**
+        ** \brief Resource transients are allocated from, outside of an
+        ** ArenaScope. Null for the global heap.
+        */
+        std::pmr::memory_resource *transient_resource = nullptr;
+    };
+}
+
+#endif
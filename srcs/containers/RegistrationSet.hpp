@@ -0,0 +1,252 @@
+/**
+** \file RegistrationSet.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 23:20
+** \date Last update: 2026-10-17 23:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_RegistrationSet_hpp__
+#define containers_RegistrationSet_hpp__
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#include "type_desc.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Turn a plain type descriptor into a type_desc::With without
+        ** arguments. type_desc::With registrations are kept as they are.
+        */
+        template <class Reg>
+        struct __static_registration {
+            using type = type_desc::With<Reg>;
+        };
+
+        /**
+        ** \internal
+        ** \brief Turn a plain type descriptor into a type_desc::With without
+        ** arguments. type_desc::With registrations are kept as they are.
+        */
+        template <class TypeDesc, typename... As>
+        struct __static_registration<type_desc::With<TypeDesc, As...>> {
+            using type = type_desc::With<TypeDesc, As...>;
+        };
+
+        /**
+        ** \internal
+        ** \brief Whether T is one of Ts.
+        */
+        template <class T, class... Ts>
+        constexpr bool __in(type_traits::type_list<Ts...>) {
+            return (false || ... || std::is_same_v<T, Ts>);
+        }
+
+        /**
+        ** \internal
+        ** \brief Whether every one of Ts is registered by one of Regs.
+        */
+        template <class... Ts, class... Regs>
+        constexpr bool __registered(type_traits::type_list<Ts...>, type_traits::type_list<Regs...>) {
+            return (true && ... && __in<Ts>(type_traits::type_list<typename Regs::regs...>{}));
+        }
+
+        /**
+        ** \internal
+        ** \brief Dependencies of a registration, as declared by the
+        ** unwrappers of its constructor arguments.
+        */
+        template <class Reg, class Args = typename Reg::args>
+        struct __registration_deps;
+
+        /**
+        ** \internal
+        ** \brief Dependencies of a registration, as declared by the
+        ** unwrappers of its constructor arguments.
+        */
+        template <class Reg, typename... As>
+        struct __registration_deps<Reg, type_traits::type_list<As...>> {
+            template <class T>
+            static constexpr bool builds = (false || ... ||
+                    __in<T>(typename utils::value::_internals::__value_unwrapper<As>::builds{}));
+
+            template <class T>
+            static constexpr bool captures = (false || ... ||
+                    __in<T>(typename utils::value::_internals::__value_unwrapper<As>::captures{}));
+
+            template <class... Regs>
+            static constexpr bool registered([[maybe_unused]] type_traits::type_list<Regs...> regs) {
+                return (true && ... && __registered(typename utils::value::_internals::__value_unwrapper<As>::needs{}, regs));
+            }
+        };
+
+        /**
+        ** \internal
+        ** \brief Check a single registration, so that a failure names it.
+        */
+        template <class Reg, bool complete, bool acyclic, bool captive_free>
+        struct __check_registration {
+            static_assert(complete, "A dependency of this registration is not part of the registration set.");
+            static_assert(acyclic, "This registration depends on itself, through a dependency cycle.");
+            static_assert(captive_free, "This singleton keeps an instance with a shorter lifetime.");
+
+            static constexpr bool value = complete && acyclic && captive_free;
+        };
+    }
+
+    /**
+    ** \brief Set of registrations, validated at compile time.
+    **
+    ** A registration set is a list of type descriptors, or type_desc::With,
+    ** exactly as given to StaticContainer. The dependencies of each
+    ** registration are read from the types of its constructor arguments, and
+    ** checked without building anything:
+    **  - complete: every dependency is registered in the set. Value holding
+    **  types need nothing, inject::All accepts an empty list, and
+    **  inject::Named, whose keyed registrations are not part of sets, is not
+    **  checked.
+    **  - acyclic: no registration depends on itself. Only dependencies built
+    **  along with the instance count: inject::Lazy and inject::Factory break
+    **  cycles.
+    **  - captive_free: no singleton keeps a reference to an instance with
+    **  another lifetime, which would then live as long as the singleton.
+    **  Rvalue reference arguments are owned by the singleton, and allowed.
+    **
+    ** \code
+    ** using Set = clonixin::RegistrationSet<
+    **     With<Transient<Service>, Logger>,
+    **     Singleton<Logger>
+    ** >;
+    **
+    ** static_assert(Set::validate());
+    ** container.addTypes<Set>();
+    ** \endcode
+    **
+    ** validate() checks each registration on its own, so that the compiler
+    ** names the faulty one, while isValid() and the other is* functions only
+    ** return a boolean.
+    **
+    ** \tparam Regs Type descriptors, or type_desc::With.
+    */
+    template <class... Regs>
+    class RegistrationSet {
+        public:
+            using registrations = type_traits::type_list<typename _internals::__static_registration<Regs>::type...>;
+
+            static constexpr std::size_t size = sizeof...(Regs);
+
+        private:
+            using row = std::array<bool, size>;
+
+            template <class Reg>
+            static constexpr row _buildsRow() {
+                return row{ { _internals::__registration_deps<Reg>::template builds<
+                    typename _internals::__static_registration<Regs>::type::regs>... } };
+            }
+
+            template <class Reg>
+            static constexpr bool _captive() {
+                using type_desc::Lifetime;
+
+                if constexpr (Reg::lifetime != Lifetime::Singleton) {
+                    return false;
+                } else {
+                    return (false || ... || (
+                        _internals::__registration_deps<Reg>::template captures<
+                            typename _internals::__static_registration<Regs>::type::regs>
+                        && _internals::__static_registration<Regs>::type::lifetime != Lifetime::Singleton
+                    ));
+                }
+            }
+
+            /**
+            ** \internal
+            ** \brief Whether the i-th registration depends on the j-th one,
+            ** directly or not.
+            */
+            static constexpr std::array<row, size> _reach() {
+                std::array<row, size> reach{ { _buildsRow<typename _internals::__static_registration<Regs>::type>()... } };
+
+                for (std::size_t k = 0; k < size; ++k)
+                    for (std::size_t i = 0; i < size; ++i)
+                        for (std::size_t j = 0; j < size; ++j)
+                            reach[i][j] = reach[i][j] || (reach[i][k] && reach[k][j]);
+                return reach;
+            }
+
+            static constexpr std::array<bool, size> _cyclic() {
+                auto reach = _reach();
+                std::array<bool, size> cyclic{};
+
+                for (std::size_t i = 0; i < size; ++i)
+                    cyclic[i] = reach[i][i];
+                return cyclic;
+            }
+
+            template <std::size_t... Is>
+            static constexpr bool _validate(std::index_sequence<Is...>) {
+                constexpr auto cyclic = _cyclic();
+
+                return (true && ... && _internals::__check_registration<
+                    typename _internals::__static_registration<Regs>::type,
+                    _internals::__registration_deps<typename _internals::__static_registration<Regs>::type>::registered(registrations{}),
+                    !cyclic[Is],
+                    !_captive<typename _internals::__static_registration<Regs>::type>()
+                >::value);
+            }
+
+        public:
+            /**
+            ** \brief Whether every dependency is registered in the set.
+            */
+            static constexpr bool isComplete() {
+                return (true && ... && _internals::__registration_deps<
+                    typename _internals::__static_registration<Regs>::type>::registered(registrations{}));
+            }
+
+            /**
+            ** \brief Whether the registrations are free of dependency cycles.
+            */
+            static constexpr bool isAcyclic() {
+                for (bool cyclic: _cyclic())
+                    if (cyclic)
+                        return false;
+                return true;
+            }
+
+            /**
+            ** \brief Whether no singleton keeps an instance with a shorter
+            ** lifetime.
+            */
+            static constexpr bool isCaptiveFree() {
+                return (true && ... && !_captive<typename _internals::__static_registration<Regs>::type>());
+            }
+
+            /**
+            ** \brief Whether every check passes.
+            */
+            static constexpr bool isValid() {
+                return isComplete() && isAcyclic() && isCaptiveFree();
+            }
+
+            /**
+            ** \brief Check every registration, failing to compile on the
+            ** first invalid one.
+            **
+            ** \return true.
+            */
+            static constexpr bool validate() {
+                return _validate(std::index_sequence_for<Regs...>{});
+            }
+    };
+}
+
+#endif
@@ -0,0 +1,232 @@
+/**
+** \file ResolutionPlan.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-18 00:20
+** \date Last update: 2026-10-18 00:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_ResolutionPlan_hpp__
+#define containers_ResolutionPlan_hpp__
+
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "containers/ContainerFwd.hpp"
+#include "utils/TypeId.hpp"
+
+namespace clonixin {
+    /**
+    ** \brief Statistics of a resolution plan, as returned by
+    ** ResolutionPlan::getStats.
+    */
+    struct PlanStats {
+        /**
+        ** \brief Number of instances the plan builds itself, the requested
+        ** one included.
+        */
+        std::size_t steps = 0;
+
+        /**
+        ** \brief Number of dependencies left to the container, such as
+        ** singletons.
+        */
+        std::size_t boundaries = 0;
+
+        /**
+        ** \brief Length of the longest chain of instances built by the plan.
+        ** This is how deep resolving would have recursed.
+        */
+        std::size_t depth = 0;
+
+        /**
+        ** \brief Number of times the plan has been compiled, the first one
+        ** included.
+        */
+        std::size_t compilations = 0;
+
+        /**
+        ** \brief Number of instances resolved through the plan.
+        */
+        std::size_t runs = 0;
+    };
+
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Instance built by a resolution plan.
+        */
+        struct PlanStep {
+            /**
+            ** \brief Builder of the instance.
+            */
+            std::shared_ptr<builders::IBuilder> builder;
+
+            /**
+            ** \brief Position of the first argument of the instance in
+            ** CompiledPlan::args.
+            */
+            std::size_t first_arg = 0;
+
+            /**
+            ** \brief Number of arguments of the instance, as listed by
+            ** IBuilder::getArguments.
+            */
+            std::size_t arg_count = 0;
+        };
+
+        /**
+        ** \internal
+        ** \brief Flat list of the instances to build to resolve a type.
+        **
+        ** Steps are in topological order: the arguments of a step are built
+        ** by the steps before it, and the last step builds the requested
+        ** instance. Each instance built is used exactly once, so that
+        ** transients needed twice are built twice, as they would be
+        ** otherwise.
+        */
+        struct CompiledPlan {
+            /**
+            ** \brief Argument left to the container.
+            */
+            static constexpr std::size_t no_step = std::numeric_limits<std::size_t>::max();
+
+            /**
+            ** \brief Instances to build, in order. Empty if the requested
+            ** type cannot be built by a plan.
+            */
+            std::vector<PlanStep> steps;
+
+            /**
+            ** \brief Arguments of every step, as the position of the step
+            ** building them, or no_step.
+            */
+            std::vector<std::size_t> args;
+
+            /**
+            ** \brief Largest number of arguments of a step.
+            */
+            std::size_t max_args = 0;
+
+            /**
+            ** \brief Registry generation the plan was compiled against.
+            */
+            std::size_t generation = 0;
+
+            /**
+            ** \brief Number of arguments left to the container.
+            */
+            std::size_t boundaries = 0;
+
+            /**
+            ** \brief Length of the longest chain of steps.
+            */
+            std::size_t depth = 0;
+        };
+
+        /**
+        ** \internal
+        ** \brief State shared by the copies of a ResolutionPlan.
+        */
+        struct PlanState {
+            /**
+            ** \brief The current plan. Accessed with the atomic shared_ptr
+            ** functions, as it's replaced once stale.
+            */
+            std::shared_ptr<CompiledPlan const> compiled;
+
+            std::atomic<std::size_t> compilations{0};
+            std::atomic<std::size_t> runs{0};
+        };
+    }
+
+    /**
+    ** \brief Precompiled resolution of a type.
+    **
+    ** A plan is made by Container::compilePlan. The registrations needed to
+    ** build T are walked once, and turned into a flat list of instances to
+    ** build, dependencies first. Resolving T through the plan then runs that
+    ** list in a loop: each transient is built by its builder from the
+    ** instances built before it, without looking it up, nor recursing
+    ** through Container::getInstance. The stack depth no longer grows with
+    ** the depth of the dependency graph.
+    **
+    ** Only transients whose builder supports IBuilder::buildFrom, as those
+    ** made by addType, are built by the plan. Other dependencies, such as
+    ** singletons, are requested to the container as usual.
+    **
+    ** Registering a type makes every plan of the container stale. A stale
+    ** plan is compiled again the next time it's used.
+    **
+    ** Plans can be copied, and used from several threads at once. Copies
+    ** share their compiled plan and statistics. A plan must not outlive its
+    ** container.
+    **
+    ** \tparam T The type resolved by the plan.
+    */
+    template <class T>
+    class ResolutionPlan {
+        public:
+            std::shared_ptr<T> operator()() const;
+            PlanStats getStats() const;
+
+        private:
+            friend class Container;
+
+            ResolutionPlan(Container const &container, std::shared_ptr<_internals::CompiledPlan const> compiled);
+
+            Container const *_container;
+            std::shared_ptr<_internals::PlanState> _state;
+    };
+
+    /**
+    ** \internal
+    ** \brief Create a plan, from its first compilation.
+    **
+    ** \param container The container the plan belongs to.
+    ** \param compiled The compiled plan.
+    */
+    template <class T>
+    inline ResolutionPlan<T>::ResolutionPlan(Container const &container, std::shared_ptr<_internals::CompiledPlan const> compiled)
+    : _container(&container), _state(std::make_shared<_internals::PlanState>()) {
+        _state->compiled = std::move(compiled);
+        _state->compilations.store(1, std::memory_order_relaxed);
+    }
+
+    /**
+    ** \brief Get a new instance of T, as Container::getInstance<T>() would.
+    **
+    ** \throw Whatever Container::getInstance<T>() throws.
+    **
+    ** \return A std::shared_ptr to the instance.
+    */
+    template <class T>
+    inline std::shared_ptr<T> ResolutionPlan<T>::operator()() const {
+        return _container->template _runPlan<T>(*_state);
+    }
+
+    /**
+    ** \brief Get the statistics of the plan.
+    **
+    ** \return The statistics of the current compilation, along with the
+    ** counters shared by the copies of the plan.
+    */
+    template <class T>
+    inline PlanStats ResolutionPlan<T>::getStats() const {
+        auto compiled = std::atomic_load(&_state->compiled);
+        PlanStats stats;
+
+        stats.steps = compiled->steps.size();
+        stats.boundaries = compiled->boundaries;
+        stats.depth = compiled->depth;
+        stats.compilations = _state->compilations.load(std::memory_order_relaxed);
+        stats.runs = _state->runs.load(std::memory_order_relaxed);
+        return stats;
+    }
+}
+
+#endif
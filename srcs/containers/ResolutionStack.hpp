@@ -0,0 +1,150 @@
+/**
+** \file ResolutionStack.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 23:40
+** \date Last update: 2026-10-18 11:45
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_ResolutionStack_hpp__
+#define containers_ResolutionStack_hpp__
+
+#include <array>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "exceptions/ContainerException.hpp"
+#include "utils/TypeId.hpp"
+
+namespace clonixin::_internals {
+    /**
+    ** \internal
+    ** \brief A type being built, along with the container building it.
+    */
+    struct ResolutionEntry {
+        void const *owner;
+        utils::type_id_t id;
+    };
+
+    /**
+    ** \internal
+    ** \brief Types being built on the calling thread, innermost last.
+    **
+    ** The first capacity entries are kept in a fixed array, so that tracking
+    ** usual builds never allocates. Deeper entries go to an overflow list,
+    ** so that cycles of any length are found.
+    */
+    struct ResolutionStack {
+        static constexpr std::size_t capacity = 64;
+
+        ResolutionEntry const &operator[](std::size_t i) const noexcept {
+            return i < capacity ? entries[i] : overflow[i - capacity];
+        }
+
+        void check(void const *owner, utils::type_id_t id) const;
+
+        std::array<ResolutionEntry, capacity> entries;
+        std::vector<ResolutionEntry> overflow;
+        std::size_t depth = 0;
+    };
+
+    /**
+    ** \internal
+    ** \brief Resolution stack of the calling thread.
+    */
+    inline ResolutionStack &resolutionStack() noexcept {
+        static thread_local ResolutionStack stack;
+        return stack;
+    }
+
+    /**
+    ** \internal
+    ** \brief Mark a type as being built on the calling thread, until
+    ** destroyed.
+    **
+    ** The container creates a frame around every builder call. If the type
+    ** is already being built by the same container on the same thread,
+    ** building it again would recurse forever: the chain of types leading
+    ** back to it is reported instead. Singletons requesting themselves are
+    ** caught earlier, as deadlocks, since they wait for their own build.
+    */
+    class ResolutionFrame {
+        public:
+            ResolutionFrame(void const *owner, utils::type_id_t id);
+            ResolutionFrame(ResolutionFrame const &) = delete;
+            ResolutionFrame &operator=(ResolutionFrame const &) = delete;
+            ~ResolutionFrame();
+
+        private:
+            ResolutionStack &_stack;
+    };
+
+    /**
+    ** \internal
+    ** \brief Push id on the resolution stack of the calling thread.
+    **
+    ** \param owner The container building the type.
+    ** \param id Dense identifier of the type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if owner is already building id on this thread.
+    */
+    inline ResolutionFrame::ResolutionFrame(void const *owner, utils::type_id_t id) : _stack(resolutionStack()) {
+        std::size_t depth = _stack.depth;
+
+        _stack.check(owner, id);
+        if (depth < ResolutionStack::capacity)
+            _stack.entries[depth] = { owner, id };
+        else
+            _stack.overflow.push_back({ owner, id });
+        _stack.depth = depth + 1;
+    }
+
+    /**
+    ** \internal
+    ** \brief Pop the frame.
+    */
+    inline ResolutionFrame::~ResolutionFrame() {
+        if (--_stack.depth >= ResolutionStack::capacity)
+            _stack.overflow.pop_back();
+    }
+
+    /**
+    ** \internal
+    ** \brief Check whether owner is already building id on this thread.
+    **
+    ** \param owner The container building the type.
+    ** \param id Dense identifier of the type.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::CircularDependency>
+    ** Thrown if it is, naming every type from the first build of id back to
+    ** id.
+    */
+    inline void ResolutionStack::check(void const *owner, utils::type_id_t id) const {
+        using Error = clonixin::exceptions::ContainerError;
+        std::size_t from = depth;
+
+        while (from-- > 0)
+            if ((*this)[from].id == id && (*this)[from].owner == owner)
+                break;
+        if (from >= depth)
+            return;
+
+        std::string chain;
+
+        for (std::size_t i = from; i < depth; ++i) {
+            chain += utils::typeIndex((*this)[i].id).name();
+            chain += " -> ";
+        }
+        chain += utils::typeIndex(id).name();
+
+        throw exceptions::ContainerException<Error::CircularDependency>(
+                exceptions::CONTAINER_ERROR_DESC[(size_t)Error::CircularDependency] + chain,
+                __FILE__, __LINE__
+                );
+    }
+}
+
+#endif
@@ -0,0 +1,228 @@
+/**
+** \file Scope.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 16:05
+** \date Last update: 2026-10-18 11:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_Scope_hpp__
+#define containers_Scope_hpp__
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include "containers/ContainerFwd.hpp"
+
+namespace clonixin {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Instances of the scoped types of a scope.
+        **
+        ** Each scoped registration is given a slot number when registered, so
+        ** a scope is a flat array of instances, indexed by slot.
+        */
+        struct ScopeState {
+            /**
+            ** \brief The container the scope was created from.
+            */
+            Container const *container = nullptr;
+
+            /**
+            ** \brief Instances, indexed by slot. Empty until first requested.
+            */
+            std::unique_ptr<std::any[]> slots;
+
+            /**
+            ** \brief Number of slots.
+            */
+            std::size_t size = 0;
+        };
+
+        /**
+        ** \internal
+        ** \brief Scope bound to the calling thread, if any.
+        **
+        ** A scope is bound while an instance is requested through it, so that
+        ** the container knows where to store scoped instances, including
+        ** those built as dependencies.
+        */
+        inline ScopeState const *&currentScope() noexcept {
+            static thread_local ScopeState const *current = nullptr;
+            return current;
+        }
+
+        /**
+        ** \internal
+        ** \brief Bind a scope to the calling thread, until destroyed.
+        **
+        ** Binding no scope suspends the current one. Instances outliving the
+        ** scope, such as singletons, are built that way, so that they cannot
+        ** keep a scoped instance: requesting one throws instead.
+        */
+        class ScopeBinding {
+            public:
+                explicit ScopeBinding(ScopeState const *state) noexcept : _previous(currentScope()) {
+                    currentScope() = state;
+                }
+                ScopeBinding(ScopeBinding const &) = delete;
+                ScopeBinding &operator=(ScopeBinding const &) = delete;
+                ~ScopeBinding() { currentScope() = _previous; }
+
+            private:
+                ScopeState const *_previous;
+        };
+    }
+
+    /**
+    ** \brief Lifetime scope of a container.
+    **
+    ** Types registered with the Scoped lifetime are built once per scope: every
+    ** request made through a given scope, directly or as a dependency, gets the
+    ** same instance, and the scope releases its instances when destroyed.
+    ** Other lifetimes are resolved as they would be by the container.
+    **
+    ** Scopes are created by Container::createScope. Creating one costs a
+    ** single allocation, of one slot per scoped registration, and nothing at
+    ** all if there is none.
+    **
+    ** A scope must not be used from several threads at once, and must not
+    ** outlive its container.
+    */
+    class Scope {
+        public:
+            Scope(Scope &&) noexcept = default;
+            Scope &operator=(Scope &&) noexcept = default;
+            Scope(Scope const &) = delete;
+            Scope &operator=(Scope const &) = delete;
+
+            template <class T> std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> getInstance() const;
+            template <class T> std::enable_if_t<std::is_rvalue_reference_v<T>, T &&> getInstance() const;
+            template <class T, utils::key_hash_t K> std::shared_ptr<T> getInstance(tag::container::key_t<K>) const;
+            template <class... Ts> std::tuple<std::shared_ptr<Ts>...> getInstances() const;
+            template <class T> std::vector<std::shared_ptr<T>> getAll() const;
+            template <class T> T resolve() const;
+
+        private:
+            friend class Container;
+
+            Scope(Container const &container, std::size_t size);
+
+            _internals::ScopeState _state;
+    };
+
+    /**
+    ** \internal
+    ** \brief Create an empty scope.
+    **
+    ** \param container The container the scope belongs to.
+    ** \param size The number of scoped registrations.
+    */
+    inline Scope::Scope(Container const &container, std::size_t size) {
+        _state.container = &container;
+        _state.size = size;
+        if (size != 0)
+            _state.slots = std::make_unique<std::any[]>(size);
+    }
+
+    /**
+    ** \brief Get a given instance as a shared_ptr, within this scope.
+    **
+    ** \tparam T The type of the instance to be returned.
+    **
+    ** \return A std::shared_ptr to the instance.
+    **
+    ** \throw Whatever Container::getInstance<T>() throws.
+    */
+    template <class T>
+    inline std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> Scope::getInstance() const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->getInstance<T>();
+    }
+
+    /**
+    ** \brief Get a given instance, using move semantics, within this scope.
+    **
+    ** \tparam T The type of the instance to be returned, as an rvalue
+    ** reference.
+    **
+    ** \return The instance.
+    **
+    ** \throw Whatever Container::getInstance<T>() throws.
+    */
+    template <class T>
+    inline std::enable_if_t<std::is_rvalue_reference_v<T>, T &&> Scope::getInstance() const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->getInstance<T>();
+    }
+
+    /**
+    ** \brief Get the instance of T registered under a key, within this scope.
+    **
+    ** \tparam T The type of the instance to be returned.
+    ** \tparam K The hash of the key.
+    **
+    ** \return A std::shared_ptr to the instance.
+    **
+    ** \throw Whatever Container::getInstance<T>(tag::container::key_t<K>) throws.
+    */
+    template <class T, utils::key_hash_t K>
+    inline std::shared_ptr<T> Scope::getInstance(tag::container::key_t<K> key) const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->getInstance<T>(key);
+    }
+
+    /**
+    ** \brief Get several instances at once, within this scope.
+    **
+    ** \tparam Ts The types of the instances to be returned.
+    **
+    ** \return A std::tuple holding a std::shared_ptr to each instance.
+    **
+    ** \throw Whatever Container::getInstances<Ts...>() throws.
+    */
+    template <class... Ts>
+    inline std::tuple<std::shared_ptr<Ts>...> Scope::getInstances() const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->getInstances<Ts...>();
+    }
+
+    /**
+    ** \brief Get an instance of every registration of T, within this scope.
+    **
+    ** \tparam T The registered type.
+    **
+    ** \return The instances, in registration order.
+    **
+    ** \throw Whatever Container::getAll<T>() throws.
+    */
+    template <class T>
+    inline std::vector<std::shared_ptr<T>> Scope::getAll() const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->getAll<T>();
+    }
+
+    /**
+    ** \brief Build a transient instance, and return it by value, within this
+    ** scope.
+    **
+    ** \tparam T The type of the instance to be returned.
+    **
+    ** \return The newly built instance.
+    **
+    ** \throw Whatever Container::resolve<T>() throws.
+    */
+    template <class T>
+    inline T Scope::resolve() const {
+        _internals::ScopeBinding binding(&_state);
+        return _state.container->resolve<T>();
+    }
+}
+
+#endif
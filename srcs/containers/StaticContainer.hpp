@@ -0,0 +1,273 @@
+/**
+** \file StaticContainer.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 12:05
+** \date Last update: 2026-10-17 23:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_StaticContainer_hpp__
+#define containers_StaticContainer_hpp__
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "containers/RegistrationSet.hpp"
+#include "type_desc.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin {
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Position of the registration of R among Regs, or
+        ** sizeof...(Regs) if R is not registered.
+        */
+        template <class R, class... Regs>
+        constexpr std::size_t __static_index() {
+            constexpr bool matches[] = { std::is_same_v<R, typename Regs::regs>..., false };
+
+            for (std::size_t i = 0; i < sizeof...(Regs); ++i)
+                if (matches[i])
+                    return i;
+            return sizeof...(Regs);
+        }
+
+        /**
+        ** \internal
+        ** \brief Number of registrations of R among Regs.
+        */
+        template <class R, class... Regs>
+        constexpr std::size_t __static_count() {
+            return (std::size_t(0) + ... + std::size_t(std::is_same_v<R, typename Regs::regs>));
+        }
+    }
+
+    /**
+    ** \brief Compile-time DI container.
+    **
+    ** A StaticContainer is given its whole registration list as template
+    ** parameters, and resolves every request at compile time: a transient is
+    ** built by a direct constructor call, and a singleton is read from a slot
+    ** of the container. There is no builder, no std::any and no lookup
+    ** involved, and asking for a type that is not registered does not
+    ** compile.
+    **
+    ** Registrations are either plain type descriptors, for types that are
+    ** default constructible, or type_desc::With, to give the types of the
+    ** constructor arguments, exactly as they would be given to
+    ** Container::addType. Value holding types are supported.
+    **
+    ** Singletons are built exactly once, even when requested from several
+    ** threads at once.
+    **
+    ** The registrations must form a complete and acyclic RegistrationSet: a
+    ** missing dependency, or a dependency cycle, does not compile.
+    **
+    ** \code
+    ** using namespace clonixin::type_desc;
+    ** clonixin::StaticContainer<
+    **     With<Transient<T1>, T2>,
+    **     Singleton<T2>
+    ** > c;
+    **
+    ** std::shared_ptr<T1> inst = c.get<T1>();
+    ** \endcode
+    **
+    ** \tparam Regs Type descriptors, or type_desc::With.
+    */
+    template <class... Regs>
+    class StaticContainer {
+        static_assert(RegistrationSet<Regs...>::isComplete(),
+                "A dependency is not registered in this StaticContainer.");
+        static_assert(RegistrationSet<Regs...>::isAcyclic(),
+                "The registrations of this StaticContainer have a dependency cycle.");
+
+        public:
+            StaticContainer() = default;
+            StaticContainer(StaticContainer const &) = delete;
+            StaticContainer &operator=(StaticContainer const &) = delete;
+
+            template <class T> std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> get() const;
+            template <class T> std::enable_if_t<std::is_rvalue_reference_v<T>, std::remove_reference_t<T>> get() const;
+
+            template <class T> std::vector<std::shared_ptr<T>> getAll() const;
+
+            template <class T> decltype(auto) getInstance() const { return get<T>(); }
+            template <class T> T resolve() const { return get<T &&>(); }
+
+        private:
+            using registrations = std::tuple<typename _internals::__static_registration<Regs>::type...>;
+
+            template <class T>
+            static constexpr std::size_t _index = _internals::__static_index<T, typename _internals::__static_registration<Regs>::type...>();
+
+            template <std::size_t I>
+            std::shared_ptr<typename std::tuple_element_t<I, registrations>::regs> _getAt() const;
+            template <class T, std::size_t... Is>
+            void _collect(std::vector<std::shared_ptr<T>> &all, std::index_sequence<Is...>) const;
+
+            template <class Reg, typename... As>
+            std::shared_ptr<typename Reg::type> _build(type_traits::type_list<As...>) const;
+            template <class Reg, typename... As>
+            typename Reg::type _buildVal(type_traits::type_list<As...>) const;
+
+            mutable std::tuple<std::shared_ptr<typename _internals::__static_registration<Regs>::type::regs>...> _slots;
+            mutable std::array<std::once_flag, sizeof...(Regs)> _once;
+    };
+
+    /**
+    ** \brief Get an instance of T as a shared_ptr.
+    **
+    ** Transients are built on every call, and singletons are built on the
+    ** first one, then kept in the container.
+    **
+    ** \tparam T The type of the instance to be returned.
+    **
+    ** \return A std::shared_ptr to the instance.
+    */
+    template <class... Regs>
+    template <class T>
+    inline std::enable_if_t<std::negation_v<std::is_rvalue_reference<T>>, std::shared_ptr<T>> StaticContainer<Regs...>::get() const {
+        using type_desc::Lifetime;
+        constexpr std::size_t I = _index<T>;
+
+        static_assert(I < sizeof...(Regs), "Type is not registered in this StaticContainer.");
+        static_assert(_internals::__static_count<T, typename _internals::__static_registration<Regs>::type...>() <= 1,
+                "Type is registered more than once in this StaticContainer.");
+
+        return _getAt<I>();
+    }
+
+    /**
+    ** \brief Get an instance of every registration of T, as shared_ptrs.
+    **
+    ** Unlike get<T>(), T can be registered several times, for instance with
+    ** different implementations. The registrations are found at compile
+    ** time.
+    **
+    ** \tparam T The registered type.
+    **
+    ** \return The instances, in registration order. Empty if T is not
+    ** registered.
+    */
+    template <class... Regs>
+    template <class T>
+    inline std::vector<std::shared_ptr<T>> StaticContainer<Regs...>::getAll() const {
+        std::vector<std::shared_ptr<T>> all;
+
+        all.reserve(_internals::__static_count<T, typename _internals::__static_registration<Regs>::type...>());
+        _collect<T>(all, std::index_sequence_for<Regs...>{});
+        return all;
+    }
+
+    /**
+    ** \internal
+    ** \brief Get an instance of the I-th registration.
+    */
+    template <class... Regs>
+    template <std::size_t I>
+    inline std::shared_ptr<typename std::tuple_element_t<I, typename StaticContainer<Regs...>::registrations>::regs>
+    StaticContainer<Regs...>::_getAt() const {
+        using type_desc::Lifetime;
+        using Reg = std::tuple_element_t<I, registrations>;
+
+        static_assert(Reg::lifetime == Lifetime::Singleton || Reg::lifetime == Lifetime::Transient,
+                "Only Singleton and Transient lifetimes are supported by StaticContainer.");
+
+        if constexpr (Reg::lifetime == Lifetime::Singleton) {
+            auto &slot = std::get<I>(_slots);
+
+            std::call_once(_once[I], [this, &slot]() { slot = _build<Reg>(typename Reg::args{}); });
+            return slot;
+        } else {
+            return _build<Reg>(typename Reg::args{});
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Append an instance of each of the registrations of T among Is
+    ** to all.
+    */
+    template <class... Regs>
+    template <class T, std::size_t... Is>
+    inline void StaticContainer<Regs...>::_collect(std::vector<std::shared_ptr<T>> &all, std::index_sequence<Is...>) const {
+        auto add = [this, &all](auto index) {
+            constexpr std::size_t I = decltype(index)::value;
+
+            if constexpr (std::is_same_v<typename std::tuple_element_t<I, registrations>::regs, T>)
+                all.push_back(_getAt<I>());
+        };
+
+        (add(std::integral_constant<std::size_t, Is>{}), ...);
+    }
+
+    /**
+    ** \brief Get an instance of T by value.
+    **
+    ** This is only available for non-polymorphic transient types. The instance
+    ** is built directly in the returned value.
+    **
+    ** \tparam T The type of the instance to be returned, as an rvalue
+    ** reference.
+    **
+    ** \return The newly built instance.
+    */
+    template <class... Regs>
+    template <class T>
+    inline std::enable_if_t<std::is_rvalue_reference_v<T>, std::remove_reference_t<T>> StaticContainer<Regs...>::get() const {
+        using type_desc::Lifetime;
+        using U = std::remove_reference_t<T>;
+        constexpr std::size_t I = _index<U>;
+
+        static_assert(I < sizeof...(Regs), "Type is not registered in this StaticContainer.");
+        static_assert(_internals::__static_count<U, typename _internals::__static_registration<Regs>::type...>() <= 1,
+                "Type is registered more than once in this StaticContainer.");
+
+        using Reg = std::tuple_element_t<I, registrations>;
+
+        static_assert(Reg::lifetime == Lifetime::Transient, "Cannot return a singleton using move semantics.");
+        static_assert(!Reg::is_polymorph, "Won't use move on polymorphic class.");
+
+        return _buildVal<Reg>(typename Reg::args{});
+    }
+
+    /**
+    ** \internal
+    ** \brief Build the type described by Reg, inside a std::shared_ptr.
+    */
+    template <class... Regs>
+    template <class Reg, typename... As>
+    inline std::shared_ptr<typename Reg::type> StaticContainer<Regs...>::_build(type_traits::type_list<As...>) const {
+        using clonixin::utils::value::_internals::__value_unwrapper;
+        using T = typename Reg::type;
+
+        static_assert(std::is_constructible_v<T, typename __value_unwrapper<As>::type...>, "Cannot construct type.");
+        return std::make_shared<T>(__value_unwrapper<As>::value(*this)...);
+    }
+
+    /**
+    ** \internal
+    ** \brief Build the type described by Reg, as a value.
+    */
+    template <class... Regs>
+    template <class Reg, typename... As>
+    inline typename Reg::type StaticContainer<Regs...>::_buildVal(type_traits::type_list<As...>) const {
+        using clonixin::utils::value::_internals::__value_unwrapper;
+        using T = typename Reg::type;
+
+        static_assert(std::is_constructible_v<T, typename __value_unwrapper<As>::type...>, "Cannot construct type.");
+        return T(__value_unwrapper<As>::value(*this)...);
+    }
+}
+
+#endif
@@ -0,0 +1,80 @@
+/**
+** \file WarmUp.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 15:10
+** \date Last update: 2026-10-18 12:05
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef containers_WarmUp_hpp__
+#define containers_WarmUp_hpp__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <typeindex>
+#include <vector>
+
+#include "./Registration.hpp"
+#include "utils/TypeId.hpp"
+
+namespace clonixin {
+    /**
+    ** \brief Construction time of a singleton, as measured by
+    ** Container::warmUp.
+    **
+    ** Both values are relative to the beginning of the warm-up, so that the
+    ** singletons ending last, and the chain of dependencies leading to them,
+    ** can be found.
+    */
+    struct WarmUpTiming {
+        /**
+        ** \brief The singleton built.
+        */
+        std::type_index type;
+
+        /**
+        ** \brief Time elapsed since the beginning of the warm-up, when the
+        ** construction started.
+        */
+        std::chrono::nanoseconds start;
+
+        /**
+        ** \brief Time spent building the singleton.
+        */
+        std::chrono::nanoseconds duration;
+    };
+
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Singleton to be built by Container::warmUp.
+        */
+        struct WarmUpNode {
+            /**
+            ** \brief Dense identifier of the singleton.
+            */
+            utils::type_id_t id;
+
+            /**
+            ** \brief Registration of the singleton, which may be a member of
+            ** a collection rather than the registration id resolves to.
+            */
+            Registration *reg;
+
+            /**
+            ** \brief Positions of the nodes depending on this one.
+            */
+            std::vector<std::size_t> dependents;
+
+            /**
+            ** \brief Number of dependencies not built yet.
+            */
+            std::unique_ptr<std::atomic<std::size_t>> pending = std::make_unique<std::atomic<std::size_t>>(0);
+        };
+    }
+}
+
+#endif
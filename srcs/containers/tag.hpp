@@ -3,12 +3,14 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2021-06-08 23:31
-** \date Last update: 2021-06-12 23:17
+** \date Last update: 2026-10-17 22:50
 */
 
 #ifndef containers_tag_hpp__
 #define containers_tag_hpp__
 
+#include "utils/Key.hpp"
+
 namespace clonixin::tag {
     inline namespace container {
         /**
@@ -35,6 +37,25 @@ namespace clonixin::tag {
         */
         inline constexpr rref_t rref{};
 
+        /**
+        ** \brief Container's disambiguation helpers
+        ** Type selecting the registration of a type made under the key K,
+        ** rather than its unkeyed one.
+        **
+        ** \tparam K The hash of the key, as given by utils::keyHash.
+        */
+        template <utils::key_hash_t K>
+        struct key_t {
+            static constexpr utils::key_hash_t value = K;
+        };
+
+        /**
+        ** \brief Container's disambiguation instance
+        ** Selects the registration of a type made under the key K.
+        */
+        template <utils::key_hash_t K>
+        inline constexpr key_t<K> key{};
+
         inline namespace duplicate {
             /**
             ** \brief Control whether add* function should throw if a type has already been registered.
@@ -50,9 +71,17 @@ namespace clonixin::tag {
             ** \brief Control whether add* function should silently ignore duplicate types.
             */
             struct ignore_t{};
+
+            /**
+            ** \brief Control whether add* function should keep duplicate types
+            ** alongside the existing ones, to be requested together with
+            ** Container::getAll.
+            */
+            struct append_t{};
             inline constexpr once_t once{};
             inline constexpr override_t over{};
             inline constexpr ignore_t ignore{};
+            inline constexpr append_t append{};
         }
     }
 }
@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-06-02 22:36
-** \date Last update: 2020-06-08 15:27
+** \date Last update: 2026-10-17 23:40
 ** \copyright GNU Lesser Public Licence v3
 */
 
@@ -29,6 +29,10 @@ namespace clonixin::exceptions {
         BadLifetime,
         TypeNotFound,
         DuplicateType,
+        Sealed,
+        Deadlock,
+        NoScope,
+        CircularDependency,
         LAST
     };
 
@@ -43,7 +47,11 @@ namespace clonixin::exceptions {
         "Unknown Container Error"s,
         "Unexpected lifetime found for type : "s,
         "Could not find builder nor factory for type : "s,
-        "Another instance or builder found for type : "s
+        "Another instance or builder found for type : "s,
+        "Container is sealed, cannot register type : "s,
+        "Deadlock detected while building singleton : "s,
+        "No scope to resolve scoped type : "s,
+        "Circular dependency detected while building : "s
     };
 
     /**
@@ -0,0 +1,19 @@
+/**
+** \file inject.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 18:40
+** \date Last update: 2026-10-17 22:50
+*/
+
+#include "inject/All.hpp"
+#include "inject/Factory.hpp"
+#include "inject/Lazy.hpp"
+#include "inject/Named.hpp"
+
+/**
+** \brief Namespace containing injection wrappers, to be used as constructor
+** argument types.
+*/
+namespace clonixin::inject {
+}
@@ -0,0 +1,83 @@
+/**
+** \file All.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 22:30
+** \date Last update: 2026-10-17 23:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef inject_All_hpp__
+#define inject_All_hpp__
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/TypeId.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::inject {
+    /**
+    ** \brief Every registered implementation of a type.
+    **
+    ** Using All<T> as a constructor argument type, as in
+    ** addType<Transient<Pipeline>, All<Filter>>(), hands the constructor an
+    ** instance of every registration of T, as returned by getAll<T>(): in
+    ** registration order, in a contiguous vector. Implementations are
+    ** registered with the append duplicate tag.
+    **
+    ** \tparam T The registered type.
+    */
+    template <class T>
+    class All : public utils::value::_internals::__inject_wrap {
+        public:
+            using value_type = std::shared_ptr<T>;
+            using const_iterator = typename std::vector<std::shared_ptr<T>>::const_iterator;
+
+            explicit All(std::vector<std::shared_ptr<T>> instances) : _instances(std::move(instances)) {}
+
+            const_iterator begin() const noexcept { return _instances.begin(); }
+            const_iterator end() const noexcept { return _instances.end(); }
+            std::size_t size() const noexcept { return _instances.size(); }
+            bool empty() const noexcept { return _instances.empty(); }
+            std::shared_ptr<T> const &operator[](std::size_t i) const { return _instances[i]; }
+            std::vector<std::shared_ptr<T>> const &get() const noexcept { return _instances; }
+
+            template <class C>
+            static All inject(C const &container);
+            static void dependencies(std::vector<utils::type_id_t> &deps);
+
+            using needs = type_traits::type_list<>;
+            using builds = type_traits::type_list<T>;
+            using captures = type_traits::type_list<T>;
+
+        private:
+            std::vector<std::shared_ptr<T>> _instances;
+    };
+
+    /**
+    ** \internal
+    ** \brief Resolve every registration of T, for a constructor.
+    **
+    ** \tparam C Type of the container, either Container or a StaticContainer.
+    */
+    template <class T>
+    template <class C>
+    inline All<T> All<T>::inject(C const &container) {
+        return All(container.template getAll<T>());
+    }
+
+    /**
+    ** \internal
+    ** \brief Append the types requested to the container to deps.
+    */
+    template <class T>
+    inline void All<T>::dependencies(std::vector<utils::type_id_t> &deps) {
+        deps.push_back(utils::typeId<T>());
+    }
+}
+
+#endif
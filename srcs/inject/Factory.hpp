@@ -0,0 +1,159 @@
+/**
+** \file Factory.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 19:10
+** \date Last update: 2026-10-17 23:40
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef inject_Factory_hpp__
+#define inject_Factory_hpp__
+
+#include <any>
+#include <memory>
+#include <memory_resource>
+#include <type_traits>
+#include <vector>
+
+#include "containers/ArenaScope.hpp"
+#include "containers/ContainerFwd.hpp"
+#include "containers/ResolutionStack.hpp"
+#include "builders/IBuilder.hpp"
+#include "utils/TypeId.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::inject {
+    /**
+    ** \brief Callable building new instances of a transient type.
+    **
+    ** Using Factory<T> as a constructor argument type, as in
+    ** addType<Transient<Service>, Factory<Job>>(), hands the constructor a
+    ** callable returning a new std::shared_ptr<T> on each call.
+    **
+    ** The factory looks T up once, when injected, and keeps its builder:
+    ** calls go straight to it, without any registry lookup nor std::any,
+    ** unless the builder cannot build instances without std::any, as
+    ** LambdaBuilder. Registering T again afterwards does not affect existing
+    ** factories.
+    **
+    ** T must be registered as transient or pooled. With a StaticContainer,
+    ** calls are forwarded to its getInstance, which is already resolved at
+    ** compile time.
+    **
+    ** \warning The container must outlive the factory.
+    **
+    ** \tparam T The type to build.
+    */
+    template <class T>
+    class Factory : public utils::value::_internals::__inject_wrap {
+        public:
+            using element_type = T;
+
+            template <class C>
+            explicit Factory(C const &container);
+
+            std::shared_ptr<T> operator()() const;
+
+            template <class C>
+            static Factory inject(C const &container);
+            static void dependencies(std::vector<utils::type_id_t> &deps);
+
+            using needs = type_traits::type_list<T>;
+            using builds = type_traits::type_list<>;
+            using captures = type_traits::type_list<>;
+
+        private:
+            template <class C>
+            static std::shared_ptr<T> _resolve(void const *container);
+
+            void const *_container;
+            std::shared_ptr<builders::IBuilder const> _builder;
+            std::pmr::memory_resource *_resource = nullptr;
+            std::shared_ptr<T> (*_fallback)(void const *container) = nullptr;
+    };
+
+    /**
+    ** \brief Create a factory building T from a container.
+    **
+    ** \tparam C Type of the container, either Container or a StaticContainer.
+    **
+    ** \param container The container T is registered in.
+    **
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::TypeNotFound>
+    ** Thrown if T has not been registered.
+    ** \throw exceptions::ContainerException<exceptions::ContainerError::BadLifetime>
+    ** Thrown if T is neither transient nor pooled.
+    */
+    template <class T>
+    template <class C>
+    inline Factory<T>::Factory(C const &container) : _container(&container) {
+        if constexpr (std::is_base_of_v<Container, C>) {
+            _builder = container.getTransientBuilder(utils::typeId<T>());
+            _resource = container.getTransientResource();
+        } else
+            _fallback = &Factory::_resolve<C>;
+    }
+
+    /**
+    ** \brief Build a new instance of T.
+    **
+    ** As with Container::getInstance, transients built while an ArenaScope
+    ** is alive are allocated from its arena, and otherwise from the
+    ** transient resource the container had when the factory was created.
+    **
+    ** \throw Whatever the builder throws.
+    */
+    template <class T>
+    inline std::shared_ptr<T> Factory<T>::operator()() const {
+        if (_fallback)
+            return _fallback(_container);
+
+        auto const &container = *static_cast<Container const *>(_container);
+        clonixin::_internals::ResolutionFrame frame(_container, utils::typeId<T>());
+
+        auto *resource = clonixin::_internals::currentArena();
+
+        if (!resource)
+            resource = _resource;
+        if (resource) {
+            if (auto ptr = _builder->allocateShared(container, resource))
+                return std::static_pointer_cast<T>(ptr);
+            return std::any_cast<std::shared_ptr<T>>(_builder->allocatePtr(container, resource));
+        }
+        if (auto ptr = _builder->buildShared(container))
+            return std::static_pointer_cast<T>(ptr);
+        return std::any_cast<std::shared_ptr<T>>(_builder->buildPtr(container));
+    }
+
+    /**
+    ** \internal
+    ** \brief Build the factory injected in a constructor.
+    */
+    template <class T>
+    template <class C>
+    inline Factory<T> Factory<T>::inject(C const &container) {
+        return Factory(container);
+    }
+
+    /**
+    ** \internal
+    ** \brief Append the types requested to the container to deps. A factory
+    ** does not request anything when injected.
+    */
+    template <class T>
+    inline void Factory<T>::dependencies([[maybe_unused]] std::vector<utils::type_id_t> &deps) {}
+
+    /**
+    ** \internal
+    ** \brief Request T to a container of type C.
+    */
+    template <class T>
+    template <class C>
+    inline std::shared_ptr<T> Factory<T>::_resolve(void const *container) {
+        return static_cast<C const *>(container)->template getInstance<T>();
+    }
+}
+
+#endif
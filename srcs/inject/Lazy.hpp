@@ -0,0 +1,160 @@
+/**
+** \file Lazy.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 18:40
+** \date Last update: 2026-10-17 23:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef inject_Lazy_hpp__
+#define inject_Lazy_hpp__
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utils/TypeId.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::inject {
+    /**
+    ** \brief Dependency resolved on first use.
+    **
+    ** Using Lazy<T> as a constructor argument type, as in
+    ** addType<Transient<Service>, Lazy<Dep>>(), hands the constructor a
+    ** handle instead of a std::shared_ptr<T>. Dep is only requested to the
+    ** container the first time the handle is dereferenced, and the instance
+    ** is then kept for later uses. Copies of a handle share the instance.
+    **
+    ** Resolution is thread-safe: if several threads dereference the same
+    ** handle at once, the instance is requested once.
+    **
+    ** Since nothing is requested when the handle is built, lazy dependencies
+    ** are not followed by Container::warmUp, and can be used to break
+    ** dependency cycles.
+    **
+    ** \warning The container must outlive the handle. Scoped types are
+    ** resolved against the scope bound when the handle is first dereferenced.
+    **
+    ** \tparam T The type to resolve.
+    */
+    template <class T>
+    class Lazy : public utils::value::_internals::__inject_wrap {
+        public:
+            using element_type = T;
+
+            template <class C>
+            explicit Lazy(C const &container);
+
+            T &operator*() const;
+            T *operator->() const;
+            std::shared_ptr<T> const &get() const;
+
+            template <class C>
+            static Lazy inject(C const &container);
+            static void dependencies(std::vector<utils::type_id_t> &deps);
+
+            using needs = type_traits::type_list<T>;
+            using builds = type_traits::type_list<>;
+            using captures = type_traits::type_list<T>;
+
+        private:
+            /**
+            ** \internal
+            ** \brief State shared by copies of a handle.
+            */
+            struct State {
+                std::once_flag once;
+                std::shared_ptr<T> instance;
+                void const *container;
+                std::shared_ptr<T> (*resolve)(void const *container);
+            };
+
+            template <class C>
+            static std::shared_ptr<T> _resolve(void const *container);
+
+            std::shared_ptr<State> _state;
+    };
+
+    /**
+    ** \brief Create a handle resolving T from a container.
+    **
+    ** \tparam C Type of the container, either Container or a StaticContainer.
+    **
+    ** \param container The container T will be requested to.
+    */
+    template <class T>
+    template <class C>
+    inline Lazy<T>::Lazy(C const &container) : _state(std::make_shared<State>()) {
+        _state->container = &container;
+        _state->resolve = &Lazy::_resolve<C>;
+    }
+
+    /**
+    ** \brief Get the instance, resolving it if needed.
+    **
+    ** \throw Whatever the container throws when requesting T.
+    */
+    template <class T>
+    inline T &Lazy<T>::operator*() const {
+        return *get();
+    }
+
+    /**
+    ** \brief Get the instance, resolving it if needed.
+    **
+    ** \throw Whatever the container throws when requesting T.
+    */
+    template <class T>
+    inline T *Lazy<T>::operator->() const {
+        return get().get();
+    }
+
+    /**
+    ** \brief Get the instance as a std::shared_ptr, resolving it if needed.
+    **
+    ** If resolving throws, the handle is left unresolved, and the next use
+    ** tries again.
+    **
+    ** \throw Whatever the container throws when requesting T.
+    */
+    template <class T>
+    inline std::shared_ptr<T> const &Lazy<T>::get() const {
+        State &state = *_state;
+
+        std::call_once(state.once, [&state]() { state.instance = state.resolve(state.container); });
+        return state.instance;
+    }
+
+    /**
+    ** \internal
+    ** \brief Build the handle injected in a constructor.
+    */
+    template <class T>
+    template <class C>
+    inline Lazy<T> Lazy<T>::inject(C const &container) {
+        return Lazy(container);
+    }
+
+    /**
+    ** \internal
+    ** \brief Append the types requested to the container to deps. A lazy
+    ** dependency does not request anything when injected.
+    */
+    template <class T>
+    inline void Lazy<T>::dependencies([[maybe_unused]] std::vector<utils::type_id_t> &deps) {}
+
+    /**
+    ** \internal
+    ** \brief Request T to a container of type C.
+    */
+    template <class T>
+    template <class C>
+    inline std::shared_ptr<T> Lazy<T>::_resolve(void const *container) {
+        return static_cast<C const *>(container)->template getInstance<T>();
+    }
+}
+
+#endif
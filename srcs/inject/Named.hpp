@@ -0,0 +1,86 @@
+/**
+** \file Named.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 22:50
+** \date Last update: 2026-10-17 23:20
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef inject_Named_hpp__
+#define inject_Named_hpp__
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "containers/tag.hpp"
+#include "utils/Key.hpp"
+#include "utils/TypeId.hpp"
+#include "utils/type_traits.hpp"
+#include "utils/ValueWrapper.hpp"
+
+namespace clonixin::inject {
+    /**
+    ** \brief Dependency registered under a key.
+    **
+    ** Using Named<T, K> as a constructor argument type, as in
+    ** addType<Transient<Service>, Named<Pool, "primary"_key>>(), hands the
+    ** constructor the instance of T registered under K, with
+    ** addType<...>(tag::container::key<K>). It converts to a
+    ** std::shared_ptr<T>, so the constructor can take either.
+    **
+    ** \tparam T The registered type.
+    ** \tparam K The hash of the key, as given by the _key literal.
+    */
+    template <class T, utils::key_hash_t K>
+    class Named : public utils::value::_internals::__inject_wrap {
+        public:
+            using element_type = T;
+
+            explicit Named(std::shared_ptr<T> instance) : _instance(std::move(instance)) {}
+
+            T &operator*() const noexcept { return *_instance; }
+            T *operator->() const noexcept { return _instance.get(); }
+            std::shared_ptr<T> const &get() const noexcept { return _instance; }
+            operator std::shared_ptr<T> const &() const noexcept { return _instance; }
+
+            template <class C>
+            static Named inject(C const &container);
+            static void dependencies(std::vector<utils::type_id_t> &deps);
+
+            /**
+            ** \brief Keyed registrations are not part of RegistrationSet, so
+            ** nothing is checked at compile time.
+            */
+            using needs = type_traits::type_list<>;
+            using builds = type_traits::type_list<>;
+            using captures = type_traits::type_list<>;
+
+        private:
+            std::shared_ptr<T> _instance;
+    };
+
+    /**
+    ** \internal
+    ** \brief Resolve T under K, for a constructor.
+    **
+    ** \tparam C Type of the container.
+    */
+    template <class T, utils::key_hash_t K>
+    template <class C>
+    inline Named<T, K> Named<T, K>::inject(C const &container) {
+        return Named(container.template getInstance<T>(tag::container::key<K>));
+    }
+
+    /**
+    ** \internal
+    ** \brief Append the types requested to the container to deps.
+    */
+    template <class T, utils::key_hash_t K>
+    inline void Named<T, K>::dependencies(std::vector<utils::type_id_t> &deps) {
+        deps.push_back(utils::keyedTypeId<T, K>());
+    }
+}
+
+#endif
@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-10-18 23:20
-** \date Last update: 2020-10-18 23:20
+** \date Last update: 2026-10-17 17:40
 ** \copyright GNU Lesser Public Licence v3
 */
 
@@ -13,7 +13,10 @@
 namespace clonixin::type_desc {
     enum class Lifetime {
         Singleton,
-        Transient
+        Transient,
+        Scoped,
+        Cached,
+        Pooled
     };
 }
 
@@ -3,16 +3,18 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 23:29
-** \date Last update: 2021-06-09 13:43
+** \date Last update: 2026-10-17 17:40
 ** \copyright GNU Lesser Public Licence v3
 */
 
 #ifndef utils_TypeDescriptors_hpp__
 #define utils_TypeDescriptors_hpp__
 
+#include <cstddef>
 #include <type_traits>
 
 #include "type_desc/Lifetime.hpp"
+#include "utils/type_traits.hpp"
 
 namespace clonixin::type_desc {
     namespace _internals {
@@ -135,6 +137,74 @@ namespace clonixin::type_desc {
     */
     template <class B, class T = B>
     struct Singleton : public _internals::__type_desc<Lifetime::Singleton, B, T> {};
+
+    /**
+    ** \brief Scoped type descriptor.
+    **
+    ** Using this type descriptor will register the type B as scoped in the IoC Container.
+    ** This means that the type will be constructed once per Scope, and shared by all objects built in it.
+    **
+    ** \tparam B The type to register.
+    ** \tparam T If used, and different that B, the type that'll be used as an
+    ** implementation of B.
+    */
+    template <class B, class T = B>
+    struct Scoped : public _internals::__type_desc<Lifetime::Scoped, B, T> {};
+
+    /**
+    ** \brief Cached type descriptor.
+    **
+    ** Using this type descriptor will register the type B as cached in the IoC Container.
+    ** This means that the type will be shared by all objects, as a singleton, but only as long as one of them is
+    ** alive. Once the last reference is dropped, the instance is destroyed, and built again on the next request.
+    **
+    ** \tparam B The type to register.
+    ** \tparam T If used, and different that B, the type that'll be used as an
+    ** implementation of B.
+    */
+    template <class B, class T = B>
+    struct Cached : public _internals::__type_desc<Lifetime::Cached, B, T> {};
+
+    /**
+    ** \brief Pooled type descriptor.
+    **
+    ** Using this type descriptor will register the type B as pooled in the IoC Container.
+    ** This means that, as a transient, each request gets its own instance, but released instances are kept in a
+    ** pool of at most N, and handed out again instead of building new ones. If the type has a reset() member
+    ** function, it's called on each instance before it's put back into the pool.
+    **
+    ** \tparam B The type to register.
+    ** \tparam N Maximum number of idle instances kept in the pool.
+    ** \tparam T If used, and different that B, the type that'll be used as an
+    ** implementation of B.
+    */
+    template <class B, std::size_t N = 16, class T = B>
+    struct Pooled : public _internals::__type_desc<Lifetime::Pooled, B, T> {
+        static_assert(N != 0, "A pool must be able to keep at least one instance.");
+
+        /**
+        ** \brief Maximum number of idle instances kept in the pool.
+        */
+        static std::size_t constexpr pool_size = N;
+    };
+
+    /**
+    ** \brief Type descriptor, along with the types of its constructor
+    ** arguments.
+    **
+    ** This is what Container::addType receives as template parameters,
+    ** bundled in a single type, so that whole registrations can be handed to
+    ** compile-time containers such as StaticContainer.
+    **
+    ** \tparam TypeDesc A type descriptor, such as Transient or Singleton.
+    ** \tparam As Types of the class' constructor arguments, either types to
+    ** build or value holding types.
+    */
+    template <class TypeDesc, typename... As>
+    struct With : public TypeDesc {
+        using desc = TypeDesc;
+        using args = type_traits::type_list<As...>;
+    };
 }
 
 #endif
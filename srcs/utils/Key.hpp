@@ -0,0 +1,83 @@
+/**
+** \file Key.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 22:50
+** \date Last update: 2026-10-17 22:50
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef utils_Key_hpp__
+#define utils_Key_hpp__
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "utils/TypeId.hpp"
+
+namespace clonixin::utils {
+    /**
+    ** \brief Hash of a registration key.
+    */
+    using key_hash_t = std::uint64_t;
+
+    /**
+    ** \brief Hash a registration key, at compile time.
+    **
+    ** This is 64 bits FNV-1a. Two different keys of the same type colliding
+    ** is not detected.
+    **
+    ** \param key The key.
+    ** \param size The length of key.
+    **
+    ** \return The hash of key.
+    */
+    constexpr key_hash_t keyHash(char const *key, std::size_t size) noexcept {
+        key_hash_t hash = 0xcbf29ce484222325ull;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= static_cast<unsigned char>(key[i]);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    namespace literals {
+        /**
+        ** \brief Hash a registration key, as in key<"primary"_key>.
+        */
+        constexpr key_hash_t operator""_key(char const *key, std::size_t size) noexcept {
+            return keyHash(key, size);
+        }
+    }
+
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Type standing for T registered under the key K, so that it
+        ** gets a dense identifier of its own.
+        */
+        template <class T, key_hash_t K>
+        struct __keyed {};
+    }
+
+    /**
+    ** \brief Get the dense identifier of T registered under the key K.
+    **
+    ** As with typeId<T>(), the identifier is computed once, then kept in a
+    ** function local static. Keyed registrations are looked up exactly as
+    ** unkeyed ones, with a single probe.
+    **
+    ** \tparam T The registered type.
+    ** \tparam K The hash of the key.
+    **
+    ** \return The dense identifier of T under K.
+    */
+    template <class T, key_hash_t K>
+    inline type_id_t keyedTypeId() {
+        return typeId<_internals::__keyed<std::remove_cv_t<std::remove_reference_t<T>>, K>>();
+    }
+}
+
+#endif
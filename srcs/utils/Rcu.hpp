@@ -0,0 +1,289 @@
+/**
+** \file Rcu.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 14:02
+** \date Last update: 2026-10-17 21:40
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef utils_Rcu_hpp__
+#define utils_Rcu_hpp__
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace clonixin::utils::_internals {
+    /**
+    ** \internal
+    ** \brief Number of reader counters of each parity in an Rcu.
+    **
+    ** Readers are spread over several counters, each on its own cache line,
+    ** so that threads reading at the same time don't fight over a single
+    ** one.
+    */
+    constexpr std::size_t RCU_STRIPES = 16;
+
+    /**
+    ** \internal
+    ** \brief Reader counter, alone on its cache line.
+    */
+    struct alignas(64) RcuCounter {
+        std::atomic<std::size_t> value = 0;
+    };
+
+    /**
+    ** \internal
+    ** \brief Reader counter used by the calling thread.
+    */
+    inline std::size_t rcuStripe() noexcept {
+        static std::atomic<std::size_t> next = 0;
+        static thread_local std::size_t const stripe = next.fetch_add(1, std::memory_order_relaxed) % RCU_STRIPES;
+
+        return stripe;
+    }
+
+    /**
+    ** \internal
+    ** \brief Read-copy-update cell.
+    **
+    ** An Rcu holds an immutable snapshot of a T. Readers get the current
+    ** snapshot without ever taking a lock, and writers publish a modified
+    ** copy of it, without waiting for readers.
+    **
+    ** Replaced snapshots are reclaimed once no reader can still be using
+    ** them. Readers announce themselves on a counter of the parity of the
+    ** current epoch. A snapshot replaced during epoch e is freed once the
+    ** epoch reached e + 2, and the epoch is only moved forward when the
+    ** counters of the parity it moves to are all zero, meaning every reader
+    ** that entered two epochs ago has left. Reclamation is only attempted by
+    ** writers, and never waits: snapshots still in use are kept for a later
+    ** write, or for the destruction of the cell.
+    **
+    ** Writers are serialized by a mutex.
+    **
+    ** Snapshots, and the list of replaced ones, are allocated from the
+    ** memory resource given on construction. If T is allocator-aware, it's
+    ** given the resource too.
+    **
+    ** \tparam T Type of the snapshots. Must be default constructible and
+    ** copyable.
+    */
+    template <class T>
+    class Rcu {
+        public:
+            /**
+            ** \internal
+            ** \brief Read-side critical section.
+            **
+            ** The snapshot it gives access to stays valid as long as the
+            ** guard is alive. Guards can be nested.
+            */
+            class ReadGuard {
+                public:
+                    explicit ReadGuard(Rcu const &rcu) noexcept;
+                    ReadGuard(ReadGuard const &) = delete;
+                    ReadGuard &operator=(ReadGuard const &) = delete;
+                    ~ReadGuard();
+
+                    T const &operator*() const noexcept { return *_snapshot; }
+                    T const *operator->() const noexcept { return _snapshot; }
+
+                private:
+                    RcuCounter &_counter;
+                    T const *_snapshot;
+            };
+
+            explicit Rcu(std::pmr::memory_resource *resource = std::pmr::new_delete_resource());
+            Rcu(Rcu const &) = delete;
+            Rcu &operator=(Rcu const &) = delete;
+            ~Rcu();
+
+            ReadGuard read() const noexcept { return ReadGuard(*this); }
+
+            template <class Fun>
+            void update(Fun &&fun);
+
+        private:
+            RcuCounter &_enter() const noexcept;
+            void _reclaim();
+            template <typename... Args>
+            T *_make(Args &&...args);
+            void _destroy(T *snapshot) noexcept;
+
+            std::pmr::polymorphic_allocator<T> _alloc;
+            std::atomic<T *> _current;
+            mutable std::atomic<std::uint64_t> _epoch = 0;
+            mutable std::array<std::array<RcuCounter, RCU_STRIPES>, 2> _readers;
+
+            std::mutex _write_mutex;
+            std::pmr::vector<std::pair<std::uint64_t, T *>> _retired;
+    };
+
+    /**
+    ** \internal
+    ** \brief Enter a read-side critical section, and get the current
+    ** snapshot.
+    */
+    template <class T>
+    inline Rcu<T>::ReadGuard::ReadGuard(Rcu const &rcu) noexcept
+    : _counter(rcu._enter()), _snapshot(rcu._current.load(std::memory_order_seq_cst)) {}
+
+    /**
+    ** \internal
+    ** \brief Leave a read-side critical section.
+    */
+    template <class T>
+    inline Rcu<T>::ReadGuard::~ReadGuard() {
+        _counter.value.fetch_sub(1, std::memory_order_release);
+    }
+
+    /**
+    ** \internal
+    ** \brief Create a cell holding a default constructed T.
+    **
+    ** \param resource Memory resource snapshots are allocated from. It must
+    ** outlive the cell.
+    */
+    template <class T>
+    inline Rcu<T>::Rcu(std::pmr::memory_resource *resource)
+    : _alloc(resource), _current(nullptr), _retired(resource) {
+        _current.store(_make(), std::memory_order_relaxed);
+    }
+
+    /**
+    ** \internal
+    ** \brief Destroy the cell, and every snapshot it still holds.
+    **
+    ** There must not be any reader left.
+    */
+    template <class T>
+    inline Rcu<T>::~Rcu() {
+        for (auto const &retired: _retired)
+            _destroy(retired.second);
+        _destroy(_current.load(std::memory_order_relaxed));
+    }
+
+    /**
+    ** \internal
+    ** \brief Allocate and build a snapshot from the memory resource.
+    */
+    template <class T>
+    template <typename... Args>
+    inline T *Rcu<T>::_make(Args &&...args) {
+        T *snapshot = _alloc.allocate(1);
+
+        try {
+            _alloc.construct(snapshot, std::forward<Args>(args)...);
+        } catch (...) {
+            _alloc.deallocate(snapshot, 1);
+            throw;
+        }
+        return snapshot;
+    }
+
+    /**
+    ** \internal
+    ** \brief Destroy a snapshot, and give its memory back to the resource.
+    */
+    template <class T>
+    inline void Rcu<T>::_destroy(T *snapshot) noexcept {
+        snapshot->~T();
+        _alloc.deallocate(snapshot, 1);
+    }
+
+    /**
+    ** \internal
+    ** \brief Publish a new snapshot.
+    **
+    ** fun is called with a copy of the current snapshot, under the writer
+    ** lock. If it returns true, the copy replaces the current snapshot. If it
+    ** returns false or throws, the copy is dropped and readers never see it.
+    **
+    ** \param fun Callable taking a T &, and returning a bool.
+    */
+    template <class T>
+    template <class Fun>
+    inline void Rcu<T>::update(Fun &&fun) {
+        std::lock_guard lock(_write_mutex);
+        T *copy = _make(*_current.load(std::memory_order_relaxed));
+
+        try {
+            if (!fun(*copy)) {
+                _destroy(copy);
+                return;
+            }
+            _retired.reserve(_retired.size() + 1);
+        } catch (...) {
+            _destroy(copy);
+            throw;
+        }
+
+        T *old = _current.exchange(copy, std::memory_order_seq_cst);
+
+        _retired.emplace_back(_epoch.load(std::memory_order_relaxed), old);
+        _reclaim();
+    }
+
+    /**
+    ** \internal
+    ** \brief Count the calling thread as a reader of the current epoch.
+    **
+    ** The epoch is checked again once the counter is incremented. If it
+    ** moved in between, a writer may have seen the counter at zero, so the
+    ** thread backs off and retries on the new epoch.
+    */
+    template <class T>
+    inline RcuCounter &Rcu<T>::_enter() const noexcept {
+        std::size_t stripe = rcuStripe();
+
+        while (true) {
+            std::uint64_t epoch = _epoch.load(std::memory_order_seq_cst);
+            RcuCounter &counter = _readers[epoch & 1][stripe];
+
+            counter.value.fetch_add(1, std::memory_order_seq_cst);
+            if (_epoch.load(std::memory_order_seq_cst) == epoch)
+                return counter;
+            counter.value.fetch_sub(1, std::memory_order_release);
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Move the epoch forward as far as possible, and free the
+    ** snapshots no reader can still hold.
+    **
+    ** Called with the writer lock held.
+    */
+    template <class T>
+    inline void Rcu<T>::_reclaim() {
+        auto drained = [this](std::uint64_t epoch) {
+            for (auto const &counter: _readers[epoch & 1])
+                if (counter.value.load(std::memory_order_seq_cst) != 0)
+                    return false;
+            return true;
+        };
+
+        std::uint64_t epoch = _epoch.load(std::memory_order_relaxed);
+
+        for (int i = 0; i < 2 && drained(epoch + 1); ++i)
+            _epoch.store(++epoch, std::memory_order_seq_cst);
+
+        auto kept = std::partition(_retired.begin(), _retired.end(),
+                [epoch](auto const &retired) { return retired.first + 2 > epoch; });
+
+        for (auto it = kept; it != _retired.end(); ++it)
+            _destroy(it->second);
+        _retired.erase(kept, _retired.end());
+    }
+}
+
+#endif
@@ -0,0 +1,188 @@
+/**
+** \file TypeId.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 11:02
+** \date Last update: 2026-10-17 14:02
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef utils_TypeId_hpp__
+#define utils_TypeId_hpp__
+
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <typeindex>
+#include <vector>
+
+#include "utils/Rcu.hpp"
+#include "utils/TypeTable.hpp"
+
+namespace clonixin::utils {
+    /**
+    ** \brief Dense identifier of a type.
+    **
+    ** Identifiers are assigned in order, starting from zero, the first time a
+    ** type is seen. They are process-wide, so that every container agree on
+    ** them, and can be used directly as an index in a flat array.
+    */
+    using type_id_t = std::size_t;
+
+    namespace _internals {
+        /**
+        ** \internal
+        ** \brief Process-wide mapping between std::type_index and dense
+        ** identifiers.
+        **
+        ** This is only used when a type is first seen, and by the type-erased
+        ** parts of the container, which only know about std::type_index.
+        **
+        ** Lookups read an Rcu snapshot of the mapping, and never lock. Only
+        ** assigning an identifier to a new type does.
+        */
+        class TypeIdRegistry {
+            public:
+                static TypeIdRegistry &instance();
+
+                type_id_t idOf(std::type_index t);
+                std::optional<type_id_t> find(std::type_index t) const;
+                std::type_index indexOf(type_id_t id) const;
+
+            private:
+                struct Ids {
+                    TypeTable<type_id_t> ids;
+                    std::vector<std::type_index> types;
+                };
+
+                TypeIdRegistry() = default;
+
+                Rcu<Ids> _ids;
+        };
+
+        /**
+        ** \internal
+        ** \brief Get the process-wide registry instance.
+        */
+        inline TypeIdRegistry &TypeIdRegistry::instance() {
+            static TypeIdRegistry registry;
+            return registry;
+        }
+
+        /**
+        ** \internal
+        ** \brief Get the identifier of a type, assigning a new one if needed.
+        **
+        ** \param t The type to look for.
+        **
+        ** \return The dense identifier of t.
+        */
+        inline type_id_t TypeIdRegistry::idOf(std::type_index t) {
+            if (auto id = find(t))
+                return *id;
+
+            type_id_t result;
+
+            _ids.update([t, &result](Ids &ids) {
+                auto [id, inserted] = ids.ids.tryEmplace(t);
+
+                if (inserted) {
+                    *id = ids.types.size();
+                    ids.types.push_back(t);
+                }
+                result = *id;
+                return inserted;
+            });
+            return result;
+        }
+
+        /**
+        ** \internal
+        ** \brief Get the identifier of a type, if it has one.
+        **
+        ** \param t The type to look for.
+        **
+        ** \return The dense identifier of t, or an empty optional if the type
+        ** was never seen.
+        */
+        inline std::optional<type_id_t> TypeIdRegistry::find(std::type_index t) const {
+            auto ids = _ids.read();
+
+            if (auto const *id = ids->ids.find(t))
+                return *id;
+            return std::nullopt;
+        }
+
+        /**
+        ** \internal
+        ** \brief Get the type matching an identifier.
+        **
+        ** \param id A dense identifier, previously returned by idOf.
+        **
+        ** \return The std::type_index of the type.
+        */
+        inline std::type_index TypeIdRegistry::indexOf(type_id_t id) const {
+            return _ids.read()->types.at(id);
+        }
+    }
+
+    /**
+    ** \brief Get the dense identifier of T.
+    **
+    ** The identifier is computed once per type and then kept in a function
+    ** local static, so that later calls neither hash nor compare type names.
+    ** As with typeid, references and cv-qualifiers are ignored.
+    **
+    ** \tparam T The type to identify.
+    **
+    ** \return The dense identifier of T.
+    */
+    template <class T>
+    inline type_id_t typeId() {
+        using U = std::remove_cv_t<std::remove_reference_t<T>>;
+
+        if constexpr (!std::is_same_v<T, U>) {
+            return typeId<U>();
+        } else {
+            static type_id_t const id = _internals::TypeIdRegistry::instance().idOf(typeid(T));
+            return id;
+        }
+    }
+
+    /**
+    ** \brief Get the dense identifier of a type, assigning a new one if
+    ** needed.
+    **
+    ** \param t The type to identify.
+    **
+    ** \return The dense identifier of t.
+    */
+    inline type_id_t typeId(std::type_index t) {
+        return _internals::TypeIdRegistry::instance().idOf(t);
+    }
+
+    /**
+    ** \brief Get the dense identifier of a type, without assigning one.
+    **
+    ** \param t The type to look for.
+    **
+    ** \return The dense identifier of t, or an empty optional if no type id
+    ** was ever requested for it.
+    */
+    inline std::optional<type_id_t> findTypeId(std::type_index t) {
+        return _internals::TypeIdRegistry::instance().find(t);
+    }
+
+    /**
+    ** \brief Get the std::type_index matching a dense identifier.
+    **
+    ** \param id A dense identifier.
+    **
+    ** \return The std::type_index of the identified type.
+    */
+    inline std::type_index typeIndex(type_id_t id) {
+        return _internals::TypeIdRegistry::instance().indexOf(id);
+    }
+}
+
+#endif
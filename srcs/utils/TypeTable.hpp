@@ -0,0 +1,160 @@
+/**
+** \file TypeTable.hpp
+**
+** \author Phantomas <phantomas@phantomas.xyz>
+** \date Created on: 2026-10-17 10:12
+** \date Last update: 2026-10-18 09:10
+** \copyright GNU Lesser Public Licence v3
+*/
+
+#ifndef utils_TypeTable_hpp__
+#define utils_TypeTable_hpp__
+
+#include <cstddef>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+namespace clonixin::utils::_internals {
+    /**
+    ** \internal
+    ** \brief Open-addressing hash table keyed by std::type_index.
+    **
+    ** The table uses linear probing over a power of two sized array, and
+    ** stores the hash of each key next to it, so that probing a slot rarely
+    ** needs to compare type names. Entries are never removed, since types
+    ** are never unregistered.
+    **
+    ** \tparam V Type of the stored values. Must be default constructible and
+    ** movable.
+    */
+    template <class V>
+    class TypeTable {
+        public:
+            V *find(std::type_index key) noexcept;
+            V const *find(std::type_index key) const noexcept;
+            std::pair<V *, bool> tryEmplace(std::type_index key);
+
+            std::size_t size() const noexcept { return _size; }
+
+        private:
+            /**
+            ** \brief A table slot. Unused slots have used set to false.
+            */
+            struct Slot {
+                std::size_t hash = 0;
+                bool used = false;
+                std::type_index key = typeid(void);
+                V value;
+            };
+
+            std::size_t _probe(std::type_index key, std::size_t hash) const noexcept;
+            void _grow();
+
+            std::vector<Slot> _slots;
+            std::size_t _size = 0;
+    };
+
+    /**
+    ** \internal
+    ** \brief Find the slot holding key, or the first free slot on its probe
+    ** sequence.
+    **
+    ** \pre The table must have at least one free slot.
+    */
+    template <class V>
+    inline std::size_t TypeTable<V>::_probe(std::type_index key, std::size_t hash) const noexcept {
+        std::size_t mask = _slots.size() - 1;
+        std::size_t i = hash & mask;
+
+        while (_slots[i].used && !(_slots[i].hash == hash && _slots[i].key == key))
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    /**
+    ** \internal
+    ** \brief Double the capacity of the table, and move every entry to its new
+    ** slot.
+    */
+    template <class V>
+    inline void TypeTable<V>::_grow() {
+        std::vector<Slot> old(_slots.empty() ? 8 : _slots.size() * 2);
+        old.swap(_slots);
+
+        for (auto &slot : old) {
+            if (!slot.used)
+                continue;
+            _slots[_probe(slot.key, slot.hash)] = std::move(slot);
+        }
+    }
+
+    /**
+    ** \internal
+    ** \brief Look up the value stored for a type.
+    **
+    ** \param key Type to look for.
+    **
+    ** \return A pointer to the value, or nullptr if the type is not in the
+    ** table.
+    */
+    template <class V>
+    inline V *TypeTable<V>::find(std::type_index key) noexcept {
+        return const_cast<V *>(std::as_const(*this).find(key));
+    }
+
+    /**
+    ** \internal
+    ** \brief Look up the value stored for a type.
+    **
+    ** \param key Type to look for.
+    **
+    ** \return A pointer to the value, or nullptr if the type is not in the
+    ** table.
+    */
+    template <class V>
+    inline V const *TypeTable<V>::find(std::type_index key) const noexcept {
+        if (_size == 0)
+            return nullptr;
+
+        Slot const &slot = _slots[_probe(key, key.hash_code())];
+        return slot.used ? &slot.value : nullptr;
+    }
+
+    /**
+    ** \internal
+    ** \brief Look up the value stored for a type, default constructing one
+    ** if needed.
+    **
+    ** \param key Type to look for.
+    **
+    ** \return A pointer to the value, and a boolean set to true if it was
+    ** just created.
+    **
+    ** The table only grows when a new key is inserted, so that looking up
+    ** an existing key never moves the stored values.
+    */
+    template <class V>
+    inline std::pair<V *, bool> TypeTable<V>::tryEmplace(std::type_index key) {
+        std::size_t hash = key.hash_code();
+        std::size_t i = _slots.empty() ? 0 : _probe(key, hash);
+
+        if (!_slots.empty() && _slots[i].used)
+            return { &_slots[i].value, false };
+
+        if ((_size + 1) * 2 > _slots.size()) {
+            _grow();
+            i = _probe(key, hash);
+        }
+
+        Slot &slot = _slots[i];
+
+        slot.hash = hash;
+        slot.used = true;
+        slot.key = key;
+        ++_size;
+        return { &slot.value, true };
+    }
+}
+
+#endif
@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2020-05-08 23:33
-** \date Last update: 2020-05-30 15:37
+** \date Last update: 2026-10-18 00:20
 ** \copyright GNU Lesser Public Licence v3
 */
 
@@ -14,9 +14,16 @@
     # define __COMP_GCC__ 1
 #endif
 
+#include <array>
+#include <cstddef>
+#include <memory>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "containers/ContainerFwd.hpp"
+#include "utils/TypeId.hpp"
+#include "utils/type_traits.hpp"
 
 namespace clonixin::utils::value {
     namespace _internals {
@@ -31,6 +38,21 @@ namespace clonixin::utils::value {
             using type = T;
         };
 
+        /**
+        ** \brief Meta-programming base of injection wrappers, such as
+        ** inject::Lazy.
+        **
+        ** An injection wrapper T is passed to the constructor as is. It's
+        ** built by T::inject(container), and lists the types it requests
+        ** while being built with T::dependencies(deps).
+        **
+        ** For compile-time validation, it also declares three type_lists:
+        ** T::needs, the types that must be registered, T::builds, the types
+        ** resolved while it's built, and T::captures, the instances it keeps
+        ** a reference to.
+        */
+        struct __inject_wrap {};
+
         /**
         ** \brief Meta-programming struct that discriminate between value
         ** holding and normal types.
@@ -50,8 +72,25 @@ namespace clonixin::utils::value {
             /**
             ** \brief A function that return the value, or use the container to
             ** build it, it T was not a value holding type.
+            **
+            ** \tparam C Type of the container, either Container or a
+            ** StaticContainer.
             */
-            static type value(Container const &c) { return c.getInstance<T>(); }
+            template <class C>
+            static type value(C const &c) { return c.template getInstance<T>(); }
+
+            /**
+            ** \brief Append the types requested to the container to deps.
+            */
+            static void dependencies(std::vector<type_id_t> &deps) { deps.push_back(typeId<T>()); }
+
+            /**
+            ** \brief Types that must be registered, built while building the
+            ** argument, and kept by the constructed instance.
+            */
+            using needs = type_traits::type_list<T>;
+            using builds = type_traits::type_list<T>;
+            using captures = type_traits::type_list<T>;
         };
 
         /**
@@ -75,8 +114,30 @@ namespace clonixin::utils::value {
             /**
             ** \brief A function that return the value, or use the container to
             ** build it, it T was not a value holding type.
+            **
+            ** The value is returned as a prvalue, built by the container's
+            ** resolve, so that it's constructed directly into the parameter,
+            ** without any temporary.
+            **
+            ** \tparam C Type of the container, either Container or a
+            ** StaticContainer.
             */
-            static type value(Container const &c) { return c.getInstance<T>(); }
+            template <class C>
+            static std::remove_reference_t<T> value(C const &c) { return c.template resolve<std::remove_reference_t<T>>(); }
+
+            /**
+            ** \brief Append the types requested to the container to deps.
+            */
+            static void dependencies(std::vector<type_id_t> &deps) { deps.push_back(typeId<T>()); }
+
+            /**
+            ** \brief Types that must be registered, built while building the
+            ** argument, and kept by the constructed instance. A value built
+            ** for the constructor is owned by it, not shared.
+            */
+            using needs = type_traits::type_list<std::remove_reference_t<T>>;
+            using builds = type_traits::type_list<std::remove_reference_t<T>>;
+            using captures = type_traits::type_list<>;
         };
 
         /**
@@ -104,9 +165,144 @@ namespace clonixin::utils::value {
             /**
             ** \brief A function that return the wrapped value.
             **
+            ** \tparam C Type of the container, either Container or a
+            ** StaticContainer.
             */
-            static constexpr type value(Container const &c) { return T::value; }
+            template <class C>
+            static constexpr type value([[maybe_unused]] C const &c) { return T::value; }
+
+            /**
+            ** \brief Append the types requested to the container to deps. A
+            ** value holding type does not request anything.
+            */
+            static void dependencies([[maybe_unused]] std::vector<type_id_t> &deps) {}
+
+            /**
+            ** \brief Types that must be registered, built while building the
+            ** argument, and kept by the constructed instance. None.
+            */
+            using needs = type_traits::type_list<>;
+            using builds = type_traits::type_list<>;
+            using captures = type_traits::type_list<>;
         };
+
+        /**
+        ** \brief Meta-programming struct that discriminate between value
+        ** holding and normal types.
+        **
+        ** This specialisation is used if T is an injection wrapper, that has
+        ** __inject_wrap as a base class. The wrapper itself is passed to the
+        ** constructor, and builds itself from the container.
+        **
+        ** \tparam T The type that we want to unwrap, if needed.
+        */
+        template <typename T>
+        struct __value_unwrapper<T, std::void_t<
+            std::enable_if_t<std::is_base_of_v<__inject_wrap, T>>
+        >> {
+            /**
+            ** \brief The wrapper type.
+            */
+            using type = T;
+
+            /**
+            ** \brief A function that return the wrapper, built from the
+            ** container.
+            **
+            ** \tparam C Type of the container, either Container or a
+            ** StaticContainer.
+            */
+            template <class C>
+            static type value(C const &c) { return T::inject(c); }
+
+            /**
+            ** \brief Append the types requested to the container to deps.
+            */
+            static void dependencies(std::vector<type_id_t> &deps) { T::dependencies(deps); }
+
+            /**
+            ** \brief Types that must be registered, built while building the
+            ** argument, and kept by the constructed instance.
+            */
+            using needs = typename T::needs;
+            using builds = typename T::builds;
+            using captures = typename T::captures;
+        };
+
+        /**
+        ** \brief Whether the argument A is an instance requested to the
+        ** container, that a resolution plan can build beforehand.
+        */
+        template <typename A>
+        constexpr bool __planned = std::is_same_v<typename __value_unwrapper<A>::type, std::shared_ptr<A>>;
+
+        /**
+        ** \brief Append the types of the arguments a resolution plan can
+        ** build beforehand to args, in order.
+        */
+        template <typename... As>
+        inline void __plan_arguments(std::vector<type_id_t> &args) {
+            ([&args]() {
+                if constexpr (__planned<As>)
+                    args.push_back(typeId<As>());
+            }(), ...);
+        }
+
+        /**
+        ** \brief Position of the instance built by a resolution plan for
+        ** each argument, among the instances it built, plus their count.
+        */
+        template <typename... As>
+        constexpr std::array<std::size_t, sizeof...(As) + 1> __plan_offsets() {
+            std::array<std::size_t, sizeof...(As) + 1> offsets{};
+            bool const planned[] = { false, __planned<As>... };
+
+            for (std::size_t i = 0; i < sizeof...(As); ++i)
+                offsets[i + 1] = offsets[i] + planned[i + 1];
+            return offsets;
+        }
+
+        /**
+        ** \brief Unwrap the argument A, taking the instance built by a
+        ** resolution plan if there is one.
+        **
+        ** \param c The container.
+        ** \param arg The instance built by the plan, as a
+        ** std::shared_ptr<void> to A. Only read if A is a planned argument,
+        ** and requested to the container if empty.
+        */
+        template <typename A, class C>
+        inline decltype(auto) __plan_value(C const &c, std::shared_ptr<void> const *arg) {
+            if constexpr (__planned<A>) {
+                if (*arg)
+                    return std::static_pointer_cast<A>(*arg);
+            }
+            return __value_unwrapper<A>::value(c);
+        }
+
+        /**
+        ** \brief Implementation of __plan_build.
+        */
+        template <typename... As, class C, class Make, std::size_t... Is>
+        inline decltype(auto) __plan_build(C const &c, [[maybe_unused]] std::shared_ptr<void> const *args, Make &&make, std::index_sequence<Is...>) {
+            [[maybe_unused]] constexpr auto offsets = __plan_offsets<As...>();
+
+            return make(__plan_value<As>(c, args + offsets[Is])...);
+        }
+
+        /**
+        ** \brief Call make with every argument of As, taking the instances
+        ** built by a resolution plan from args.
+        **
+        ** \param c The container.
+        ** \param args One instance per planned argument of As, in order, as
+        ** std::shared_ptr<void>. Empty ones are requested to the container.
+        ** \param make A function building the instance from its arguments.
+        */
+        template <typename... As, class C, class Make>
+        inline decltype(auto) __plan_build(C const &c, std::shared_ptr<void> const *args, Make &&make) {
+            return __plan_build<As...>(c, args, std::forward<Make>(make), std::index_sequence_for<As...>{});
+        }
     }
 
     /**
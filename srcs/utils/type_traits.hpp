@@ -3,7 +3,7 @@
 **
 ** \author Phantomas <phantomas@phantomas.xyz>
 ** \date Created on: 2021-06-09 00:05
-** \date Last update: 2021-06-09 00:14
+** \date Last update: 2026-10-17 12:10
 */
 
 #ifndef utils_type_traits_hpp__
@@ -17,6 +17,12 @@ namespace clonixin::type_traits {
 
     template <typename... Ts>
     static constexpr bool is_one_of_v = is_one_of<Ts...>::value;
+
+    /**
+    ** \brief Empty type holding a list of types.
+    */
+    template <typename... Ts>
+    struct type_list {};
 }
 
 #endif /* end of include guard: utils_type_traits_hpp__ */
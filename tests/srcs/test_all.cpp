@@ -0,0 +1,134 @@
+#include <criterion/criterion.h>
+
+#include <memory>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    template <int N>
+    class Filter: public tt::Interface<0> {
+        public:
+            Filter() { ++built; }
+            int getDiscr() const override { return N; }
+
+            static inline int built = 0;
+    };
+
+    struct Pipeline {
+        Pipeline(clonixin::inject::All<tt::Interface<0>> f): filters(std::move(f)) {}
+
+        clonixin::inject::All<tt::Interface<0>> filters;
+    };
+}
+
+TestSuite(ContainerAll, .description = "Testing multi-bindings.", .disabled = false);
+
+Test(ContainerAll, registrationOrder, .description = "Every appended implementation is returned, in registration order.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container
+        .addType<Transient<tt::Interface<0>, Filter<1>>>(dup::append)
+        .addType<Transient<tt::Interface<0>, Filter<2>>>(dup::append)
+        .addType<Singleton<tt::Interface<0>, Filter<3>>>(dup::append)
+    ;
+
+    auto all = container.getAll<tt::Interface<0>>();
+
+    cr_assert_eq(all.size(), 3, "Expected 3 instances, got %zu.", all.size());
+    for (int i = 0; i < 3; ++i)
+        cr_assert_eq(all[i]->getDiscr(), i + 1, "Instance %d is out of order.", i);
+    cr_assert_eq(container.getInstance<tt::Interface<0>>()->getDiscr(), 3, "Single requests should use the last registration.");
+}
+
+Test(ContainerAll, prebuiltSingletons, .description = "Collections of singletons are resolved once.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    Filter<4>::built = 0;
+    Filter<5>::built = 0;
+    container
+        .addType<Singleton<tt::Interface<0>, Filter<4>>>()
+        .addType<Singleton<tt::Interface<0>, Filter<5>>>(dup::append)
+    ;
+
+    auto first = container.getAll<tt::Interface<0>>();
+    auto second = container.getAll<tt::Interface<0>>();
+
+    cr_assert_eq(first.size(), 2, "Expected 2 instances, got %zu.", first.size());
+    cr_assert(first == second, "Singletons should be shared.");
+    cr_assert_eq(Filter<4>::built + Filter<5>::built, 2, "Each singleton should be built once.");
+}
+
+Test(ContainerAll, overrideResets, .description = "Overriding a type drops its other registrations.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container
+        .addType<Transient<tt::Interface<0>, Filter<1>>>(dup::append)
+        .addType<Transient<tt::Interface<0>, Filter<2>>>(dup::append)
+        .addType<Transient<tt::Interface<0>, Filter<3>>>()
+    ;
+
+    auto all = container.getAll<tt::Interface<0>>();
+
+    cr_assert_eq(all.size(), 1, "Expected a single instance, got %zu.", all.size());
+    cr_assert_eq(all[0]->getDiscr(), 3, "The overriding registration should be kept.");
+}
+
+Test(ContainerAll, notRegistered, .description = "Unregistered types have no instance.", .disabled = false) {
+    clonixin::Container container;
+
+    cr_assert(container.getAll<tt::Interface<0>>().empty(), "No instance should be returned.");
+}
+
+Test(ContainerAll, injected, .description = "All<T> hands every implementation to a constructor.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using clonixin::inject::All;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container
+        .addType<Transient<Pipeline>, All<tt::Interface<0>>>()
+        .addType<Transient<tt::Interface<0>, Filter<1>>>(dup::append)
+        .addType<Transient<tt::Interface<0>, Filter<2>>>(dup::append)
+    ;
+
+    auto pipeline = container.getInstance<Pipeline>();
+    int sum = 0;
+
+    for (auto const &filter: pipeline->filters)
+        sum += filter->getDiscr();
+    cr_assert_eq(pipeline->filters.size(), 2, "Expected 2 filters, got %zu.", pipeline->filters.size());
+    cr_assert_eq(sum, 3, "Filters were not all injected.");
+}
+
+Test(ContainerAll, staticContainer, .description = "StaticContainer returns every registration of a type.", .disabled = false) {
+    using namespace clonixin::type_desc;
+    using clonixin::inject::All;
+
+    clonixin::StaticContainer<
+        With<Transient<Pipeline>, All<tt::Interface<0>>>,
+        Transient<tt::Interface<0>, Filter<1>>,
+        Singleton<tt::Interface<0>, Filter<2>>
+    > container;
+
+    auto all = container.getAll<tt::Interface<0>>();
+
+    cr_assert_eq(all.size(), 2, "Expected 2 instances, got %zu.", all.size());
+    cr_assert_eq(all[0]->getDiscr(), 1, "Instances are out of order.");
+    cr_assert(all[1] == container.getAll<tt::Interface<0>>()[1], "Singletons should be shared.");
+    cr_assert_eq(container.get<Pipeline>()->filters.size(), 2, "Filters were not all injected.");
+}
@@ -0,0 +1,129 @@
+#include <criterion/criterion.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct AllocStats {
+        int allocations = 0;
+        int deallocations = 0;
+    };
+
+    template <class T>
+    struct CountingAllocator {
+        using value_type = T;
+
+        explicit CountingAllocator(AllocStats &s) : stats(&s) {}
+        template <class U>
+        CountingAllocator(CountingAllocator<U> const &other) : stats(other.stats) {}
+
+        T *allocate(std::size_t n) {
+            ++stats->allocations;
+            return std::allocator<T>().allocate(n);
+        }
+
+        void deallocate(T *p, std::size_t n) {
+            ++stats->deallocations;
+            std::allocator<T>().deallocate(p, n);
+        }
+
+        template <class U>
+        bool operator==(CountingAllocator<U> const &other) const { return stats == other.stats; }
+        template <class U>
+        bool operator!=(CountingAllocator<U> const &other) const { return stats != other.stats; }
+
+        AllocStats *stats;
+    };
+
+    class Impl: public tt::Interface<0> {
+        public:
+            Impl(int i): _i(i) {}
+            int getDiscr() const override { return _i; }
+        private:
+            int _i;
+    };
+
+    struct Plain {
+        int value = 7;
+    };
+}
+
+TestSuite(ContainerAllocator, .description = "Testing registrations with a custom allocator.", .disabled = false);
+
+Test(ContainerAllocator, polymorphicTransient, .description = "Polymorphic transients are built with one allocation from the allocator.", .disabled = false) {
+    clonixin::Container container;
+    AllocStats stats;
+
+    using namespace clonixin::type_desc;
+    using clonixin::utils::value::Int;
+
+    container.addType<Transient<tt::Interface<0>, Impl>, Int<42>>(std::allocator_arg, CountingAllocator<char>(stats));
+
+    {
+        std::shared_ptr<tt::Interface<0>> ptr = container.getInstance<tt::Interface<0>>();
+        std::shared_ptr<tt::Interface<0>> ptr2 = container.getInstance<tt::Interface<0>>();
+
+        cr_assert_eq(ptr->getDiscr(), 42, "Direct value was not passed to the constructor.");
+        cr_assert(ptr != ptr2, "Returned pointers should be different.");
+        cr_assert_eq(stats.allocations, 2, "Expected one allocation per instance, got %d.", stats.allocations);
+    }
+
+    cr_assert_eq(stats.deallocations, 2, "Instances should be released through the allocator. Got %d.", stats.deallocations);
+}
+
+Test(ContainerAllocator, polymorphicSingleton, .description = "A polymorphic singleton is built once from the allocator.", .disabled = false) {
+    AllocStats stats;
+
+    {
+        clonixin::Container container;
+
+        using namespace clonixin::type_desc;
+        using clonixin::utils::value::Int;
+
+        container.addType<Singleton<tt::Interface<0>, Impl>, Int<1>>(std::allocator_arg, CountingAllocator<char>(stats));
+
+        cr_assert(container.getInstance<tt::Interface<0>>() == container.getInstance<tt::Interface<0>>(),
+                "Returned pointers should be equals.");
+        cr_assert_eq(stats.allocations, 1, "Expected a single allocation, got %d.", stats.allocations);
+    }
+
+    cr_assert_eq(stats.deallocations, 1, "The singleton should be released through the allocator.");
+}
+
+Test(ContainerAllocator, plainType, .description = "Non polymorphic types are built from the allocator, and can still be resolved by value.", .disabled = false) {
+    clonixin::Container container;
+    AllocStats stats;
+
+    using namespace clonixin::type_desc;
+
+    container.addType<Transient<Plain>>(std::allocator_arg, CountingAllocator<char>(stats));
+
+    std::shared_ptr<Plain> ptr = container.getInstance<Plain>();
+    Plain value = container.resolve<Plain>();
+
+    cr_assert_eq(ptr->value, 7, "Instance was not built.");
+    cr_assert_eq(value.value, 7, "Value was not built.");
+    cr_assert_eq(stats.allocations, 1, "Only the shared instance should be allocated, got %d.", stats.allocations);
+}
+
+Test(ContainerAllocator, duplicateOnce, .description = "Duplicate tags apply to allocated registrations.", .disabled = false) {
+    clonixin::Container container;
+    AllocStats stats;
+
+    using namespace clonixin::type_desc;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container.addType<Transient<Plain>>();
+
+    cr_assert_throw(
+        (container.addType<Transient<Plain>>(std::allocator_arg, CountingAllocator<char>(stats), dup::once)),
+        clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>,
+        "Registering a type twice with once_t should throw."
+    );
+}
@@ -0,0 +1,118 @@
+#include <criterion/criterion.h>
+
+#include <cstddef>
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct Buffer {
+        alignas(std::max_align_t) std::byte data[4096];
+
+        bool contains(void const *ptr) const {
+            auto const *p = static_cast<std::byte const *>(ptr);
+            return p >= data && p < data + sizeof(data);
+        }
+    };
+
+    struct Dependency {};
+
+    struct Holder {
+        Holder(std::shared_ptr<Dependency> d): dep(std::move(d)) {}
+
+        std::shared_ptr<Dependency> dep;
+    };
+}
+
+TestSuite(ContainerArena, .description = "Testing arena-backed transients.", .disabled = false);
+
+Test(ContainerArena, transientsInArena, .description = "Transients built within an arena scope are allocated from it.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Transient<std::shared_ptr<Dependency>>;
+
+    container
+        .addType<Transient<TestClass>, Dependency>()
+        .addType<Transient<Dependency>>()
+    ;
+
+    Buffer buffer;
+    {
+        clonixin::ArenaScope arena(buffer.data, sizeof(buffer.data));
+
+        std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+
+        cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+        cr_assert(buffer.contains(ptr.get()), "Transient should be allocated from the arena.");
+    }
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+
+    cr_assert(!buffer.contains(ptr.get()), "Transient should not be allocated from a released arena.");
+}
+
+Test(ContainerArena, abstractInArena, .description = "Polymorphic transients are allocated from the arena too.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    class TestClass: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 42; }
+    };
+
+    container.addType<Transient<tt::Interface<0>, TestClass>>();
+
+    Buffer buffer;
+    clonixin::ArenaScope arena(buffer.data, sizeof(buffer.data));
+
+    std::shared_ptr<tt::Interface<0>> ptr = container.getInstance<tt::Interface<0>>();
+
+    cr_assert(buffer.contains(ptr.get()), "Transient should be allocated from the arena.");
+    cr_assert_eq(ptr->getDiscr(), 42, "Returned instance should be usable.");
+}
+
+Test(ContainerArena, singletonOutsideArena, .description = "Singletons and their dependencies are not allocated from the arena.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .addType<Singleton<Holder>, Dependency>()
+        .addType<Transient<Dependency>>()
+    ;
+
+    Buffer buffer;
+    std::shared_ptr<Holder> holder;
+    {
+        clonixin::ArenaScope arena(buffer.data, sizeof(buffer.data));
+
+        holder = container.getInstance<Holder>();
+        cr_assert(buffer.contains(container.getInstance<Dependency>().get()), "Transient should be allocated from the arena.");
+    }
+
+    cr_assert(!buffer.contains(holder.get()), "Singleton should not be allocated from the arena.");
+    cr_assert(!buffer.contains(holder->dep.get()), "Singleton dependencies should not be allocated from the arena.");
+}
+
+Test(ContainerArena, nestedArenas, .description = "The innermost arena is used, and the outer one restored after it.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container.addType<Transient<Dependency>>();
+
+    Buffer outer, inner;
+    clonixin::ArenaScope outer_arena(outer.data, sizeof(outer.data));
+    {
+        clonixin::ArenaScope inner_arena(inner.data, sizeof(inner.data));
+
+        cr_assert(inner.contains(container.getInstance<Dependency>().get()), "Innermost arena should be used.");
+    }
+    cr_assert(outer.contains(container.getInstance<Dependency>().get()), "Outer arena should be used again.");
+}
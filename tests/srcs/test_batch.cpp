@@ -0,0 +1,77 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <memory>
+#include <tuple>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct Session {};
+    struct Custom {};
+
+    class Impl: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 5; }
+    };
+}
+
+TestSuite(ContainerBatch, .description = "Testing batch resolution.", .disabled = false);
+
+Test(ContainerBatch, mixedLifetimes, .description = "Every lifetime can be resolved in one batch.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Single = tt::Singleton<>;
+
+    auto lambda = [](clonixin::Container const &, bool) -> std::any { return std::make_shared<Custom>(); };
+
+    container
+        .addType<Singleton<Single>>()
+        .addType<Transient<tt::Interface<0>, Impl>>()
+        .addType<Cached<Session>>()
+        .addTransient(std::make_unique<clonixin::builders::LambdaBuilder<decltype(lambda)>>(typeid(Custom), lambda))
+    ;
+
+    auto [single, iface, session, custom] = container.getInstances<Single, tt::Interface<0>, Session, Custom>();
+
+    cr_assert(single == container.getInstance<Single>(), "Singleton should be shared.");
+    cr_assert_eq(iface->getDiscr(), 5, "Transient was not built.");
+    cr_assert(session == container.getInstance<Session>(), "Cached instance should be shared while alive.");
+    cr_assert(bool(custom), "Custom builders should be resolved too.");
+    cr_assert_eq(Single::getCount(), 1, "Singleton should be built exactly once. Built %d time(s)", Single::getCount());
+}
+
+Test(ContainerBatch, missingType, .description = "A missing type fails the whole batch.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container.addType<Singleton<tt::Singleton<>>>();
+
+    cr_assert_throw((container.getInstances<tt::Singleton<>, Session>()), ContainerException<ContainerError::TypeNotFound>,
+            "Requesting an unregistered type should throw.");
+}
+
+Test(ContainerBatch, scoped, .description = "Scoped types are resolved within the scope.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .addType<Scoped<Session>>()
+        .addType<Singleton<tt::Singleton<>>>()
+    ;
+
+    auto scope = container.createScope();
+    auto [session, single] = scope.getInstances<Session, tt::Singleton<>>();
+
+    cr_assert(session == scope.getInstance<Session>(), "Scoped instance should be shared within the scope.");
+    cr_assert(bool(single), "Returned pointer should not be NULL.");
+}
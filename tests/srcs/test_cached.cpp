@@ -0,0 +1,190 @@
+#include <criterion/criterion.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory_resource>
+#include <thread>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    std::atomic<int> heavyBuilt;
+
+    struct Heavy {
+        Heavy() {
+            ++heavyBuilt;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    std::atomic<int> gatedBuilt;
+    std::promise<void> gatedBuilding;
+    std::shared_future<void> gatedRelease;
+
+    struct Gated {
+        Gated() {
+            if (++gatedBuilt == 1) {
+                gatedBuilding.set_value();
+                gatedRelease.wait();
+            }
+        }
+    };
+
+    /**
+    ** \brief Resource blocking its first allocation once armed.
+    **
+    ** The container allocates its list of waiting threads from it while
+    ** holding its init mutex, which lets a test hold that mutex: a builder
+    ** done building then queues on it to publish, and a thread finding no
+    ** instance yet queues behind it.
+    */
+    class GateResource : public std::pmr::memory_resource {
+        public:
+            std::atomic<bool> armed{false};
+            std::promise<void> entered;
+            std::shared_future<void> release;
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t align) override {
+                if (armed.exchange(false)) {
+                    entered.set_value();
+                    release.wait();
+                }
+                return std::pmr::new_delete_resource()->allocate(bytes, align);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+    };
+}
+
+TestSuite(ContainerCached, .description = "Testing cached lifetime.", .disabled = false);
+
+Test(ContainerCached, sameInstanceWhileAlive, .description = "A cached type is shared while referenced.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Cached<TestClass>>();
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+    std::shared_ptr<TestClass> ptr2 = container.getInstance<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr == ptr2, "Returned pointers should be equals.");
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerCached, rebuiltAfterRelease, .description = "A cached type is destroyed with its last reference, and built again on demand.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Cached<TestClass>>();
+
+    std::weak_ptr<TestClass> weak = container.getInstance<TestClass>();
+
+    cr_assert(weak.expired(), "Instance should be destroyed once released.");
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert_eq(TestClass::getCount(), 2, "TestClass should be built again. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerCached, cachedInterface, .description = "A cached implementation is returned through its interface.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using clonixin::utils::value::Int;
+
+    class TestClass: public tt::Interface<0> {
+        public:
+            TestClass(int i): _i(i) {}
+            int getDiscr() const override { return _i; }
+        private:
+            int _i;
+    };
+
+    container.addType<Cached<tt::Interface<0>, TestClass>, Int<42>>();
+
+    std::shared_ptr<tt::Interface<0>> ptr = container.getInstance<tt::Interface<0>>();
+
+    cr_assert(ptr == container.getInstance<tt::Interface<0>>(), "Returned pointers should be equals.");
+    cr_assert_eq(ptr->getDiscr(), 42, "Direct value was not passed to the constructor.");
+}
+
+Test(ContainerCached, concurrentRevival, .description = "Threads reviving a cached type at once build it once.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    heavyBuilt = 0;
+    container.addType<Cached<Heavy>>();
+
+    std::vector<std::shared_ptr<Heavy>> ptrs(8);
+    std::vector<std::thread> threads;
+
+    for (auto &p: ptrs)
+        threads.emplace_back([&container, &p]() { p = container.getInstance<Heavy>(); });
+    for (auto &t: threads)
+        t.join();
+
+    cr_assert_eq(heavyBuilt.load(), 1, "Heavy should be built exactly once. Built %d time(s)", heavyBuilt.load());
+    for (auto &p: ptrs)
+        cr_assert(p == ptrs[0], "Returned pointers should be equals.");
+}
+
+Test(ContainerCached, publishedWhileQueued, .description = "A thread finding no instance, then queued behind its publication, uses the published one.", .disabled = false) {
+    GateResource resource;
+    clonixin::Container container(&resource);
+
+    using namespace clonixin::type_desc;
+    using namespace std::chrono_literals;
+
+    std::promise<void> releaseBuild;
+    std::promise<void> releaseWaiter;
+
+    gatedBuilt = 0;
+    gatedRelease = releaseBuild.get_future().share();
+    resource.release = releaseWaiter.get_future().share();
+    container.addType<Cached<Gated>>();
+
+    std::shared_ptr<Gated> first, waited, queued;
+
+    std::thread builder([&]() { first = container.getInstance<Gated>(); });
+    gatedBuilding.get_future().wait();
+
+    resource.armed = true;
+    std::thread waiter([&]() { waited = container.getInstance<Gated>(); });
+    resource.entered.get_future().wait();
+
+    releaseBuild.set_value();
+    std::this_thread::sleep_for(50ms);
+
+    std::thread late([&]() { queued = container.getInstance<Gated>(); });
+    std::this_thread::sleep_for(50ms);
+
+    releaseWaiter.set_value();
+    builder.join();
+    waiter.join();
+    late.join();
+
+    cr_assert_eq(gatedBuilt.load(), 1, "Gated should be built exactly once. Built %d time(s)", gatedBuilt.load());
+    cr_assert(waited == first, "Returned pointers should be equals.");
+    cr_assert(queued == first, "Returned pointers should be equals.");
+}
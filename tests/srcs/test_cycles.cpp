@@ -0,0 +1,211 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <cstring>
+#include <memory>
+#include <utility>
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace {
+    struct Left;
+    struct Right;
+
+    struct Left {
+        Left(std::shared_ptr<Right>) {}
+    };
+
+    struct Right {
+        Right(std::shared_ptr<Left>) {}
+    };
+
+    struct Holder {
+        Holder(std::shared_ptr<Left>) {}
+    };
+
+    struct A {};
+    struct B {};
+
+    template <int N>
+    struct Link {
+        Link() = default;
+        template <class T>
+        Link(std::shared_ptr<T>) {}
+    };
+
+    template <int N>
+    struct Loop {
+        template <class T>
+        Loop(std::shared_ptr<T>) {}
+    };
+
+    template <int N>
+    struct Ring {
+        template <class T>
+        Ring(std::shared_ptr<T>) {}
+    };
+
+    template <int... Ns>
+    void addRing(clonixin::Container &c, std::integer_sequence<int, Ns...>) {
+        using namespace clonixin::type_desc;
+
+        (c.addType<Transient<Ring<Ns>>, Ring<(Ns + 1) % sizeof...(Ns)>>(), ...);
+    }
+
+    template <int... Ns>
+    void addLinks(clonixin::Container &c, std::integer_sequence<int, Ns...>) {
+        using namespace clonixin::type_desc;
+
+        (c.addType<Transient<Link<Ns>>, Link<Ns + 1>>(), ...);
+        (c.addType<Transient<Loop<Ns>>, Loop<Ns + 1>>(), ...);
+    }
+}
+
+TestSuite(ContainerCycles, .description = "Testing dependency cycles detection.", .disabled = false);
+
+Test(ContainerCycles, transientCycle, .description = "Two transients needing each other throw instead of overflowing the stack.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Transient<Left>, Right>()
+        .addType<Transient<Right>, Left>()
+    ;
+
+    cr_assert_throw(container.getInstance<Left>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+    cr_assert_throw(container.getInstance<Left &&>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerCycles, chainInMessage, .description = "The exception names every type of the cycle.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+    using namespace clonixin::exceptions;
+
+    auto buildA = [](clonixin::Container const &c, bool) -> std::any {
+        c.getInstance<B>();
+        return std::make_shared<A>();
+    };
+    auto buildB = [](clonixin::Container const &c, bool) -> std::any {
+        c.getInstance<A>();
+        return std::make_shared<B>();
+    };
+
+    container
+        .addTransient(std::make_unique<LambdaBuilder<decltype(buildA)>>(typeid(A), buildA))
+        .addTransient(std::make_unique<LambdaBuilder<decltype(buildB)>>(typeid(B), buildB))
+    ;
+
+    bool thrown = false;
+    try {
+        container.getInstance<A>();
+    } catch (ContainerException<ContainerError::CircularDependency> const &e) {
+        char const *what = e.what();
+        char const *first = std::strstr(what, typeid(A).name());
+
+        thrown = true;
+        cr_assert(first, "The first type should be named.");
+        cr_assert(std::strstr(first, typeid(B).name()), "The second type should be named after the first one.");
+        cr_assert(std::strstr(first, " -> "), "Types should be chained.");
+    }
+    cr_assert(thrown, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerCycles, throughSingleton, .description = "A cycle going through a singleton is detected, and leaves the singleton unbuilt.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Transient<Left>, Right>()
+        .addType<Singleton<Right>, Left>()
+        .addType<Transient<Holder>, Left>()
+    ;
+
+    cr_assert_throw(container.getInstance<Holder>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+    cr_assert_throw(container.getInstance<Holder>(), ContainerException<ContainerError::CircularDependency>,
+            "The singleton should be built again, not waited for.");
+
+    bool thrown = false;
+    try {
+        container.getInstance<Right>();
+    } catch (ContainerException<ContainerError::CircularDependency> const &e) {
+        char const *first = std::strstr(e.what(), typeid(Right).name());
+
+        thrown = true;
+        cr_assert(first, "The singleton should be named.");
+        cr_assert(std::strstr(first, typeid(Left).name()), "The transient should be named after the singleton.");
+    }
+    cr_assert(thrown, "A singleton requesting itself should be reported as a cycle.");
+}
+
+Test(ContainerCycles, deepChain, .description = "Chains longer than the tracked depth resolve, and their cycles are still found.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    addLinks(container, std::make_integer_sequence<int, 100>{});
+    container
+        .addType<Transient<Link<100>>>()
+        .addType<Transient<Loop<100>>, Loop<97>>()
+    ;
+
+    cr_assert(container.getInstance<Link<0>>() != nullptr, "A deep chain should resolve.");
+    cr_assert_throw(container.getInstance<Loop<0>>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+    cr_assert(container.getInstance<Link<0>>() != nullptr, "Resolution should still work after a cycle was found.");
+}
+
+Test(ContainerCycles, deepSibling, .description = "Unwinding a deep chain does not leave stale types behind.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+    using namespace clonixin::type_desc;
+
+    auto buildA = [](clonixin::Container const &c, bool) -> std::any {
+        c.getInstance<Link<0>>();
+        c.getInstance<Link<63>>();
+        return std::make_shared<A>();
+    };
+
+    addLinks(container, std::make_integer_sequence<int, 100>{});
+    container
+        .addType<Transient<Link<100>>>()
+        .addType<Transient<Loop<100>>, Loop<97>>()
+        .addTransient(std::make_unique<LambdaBuilder<decltype(buildA)>>(typeid(A), buildA))
+    ;
+
+    cr_assert(container.getInstance<A>() != nullptr, "A sibling of a deep chain should resolve.");
+}
+
+Test(ContainerCycles, longCycle, .description = "Cycles longer than the fixed part of the stack are found.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::exceptions;
+
+    addRing(container, std::make_integer_sequence<int, 100>{});
+
+    cr_assert_throw(container.getInstance<Ring<0>>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+    cr_assert_throw(container.getInstance<Ring<50>>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerCycles, otherContainer, .description = "Building a type through another container is not a cycle.", .disabled = false) {
+    clonixin::Container outer;
+    clonixin::Container inner;
+
+    using namespace clonixin::builders;
+    using namespace clonixin::type_desc;
+
+    auto buildA = [&inner](clonixin::Container const &, bool) -> std::any {
+        return inner.getInstance<A>();
+    };
+
+    outer.addTransient(std::make_unique<LambdaBuilder<decltype(buildA)>>(typeid(A), buildA));
+    inner.addType<Transient<A>>();
+
+    cr_assert(outer.getInstance<A>() != nullptr, "A should be built by the inner container.");
+}
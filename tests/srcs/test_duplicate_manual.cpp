@@ -530,3 +530,29 @@ Test(ContainerDuplicateManual, addAbstractSingletonTwiceOnce, .description = "re
     auto tc = container.getInstance<Interface>();
 }
 
+
+Test(ContainerDuplicateManual, addSingletonOverInstance, .description = "register an instance, then override it with a singleton builder.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::tag::duplicate;
+    using namespace clonixin::builders;
+
+    class TestClass {
+        public:
+            TestClass(): _i(1) {}
+            TestClass(int i): _i(i) {}
+            int _i;
+    };
+
+    int SUCCESS = 1;
+    int FAIL = 0;
+
+    container.addInstance(std::make_unique<TestClass>(FAIL));
+    auto first = container.getInstance<TestClass>();
+    container.addSingleton(std::make_unique<GenericBuilder<TestClass>>(), over);
+
+    auto tc = container.getInstance<TestClass>();
+    cr_assert_eq(tc->_i, SUCCESS, "Overridden instance was kept in container.");
+    cr_assert_not(tc == first, "Overridden instance was kept in container.");
+}
@@ -0,0 +1,136 @@
+#include <criterion/criterion.h>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+using clonixin::inject::Factory;
+
+TestSuite(InjectFactory, .description = "Testing injected factories.", .disabled = false);
+
+Test(InjectFactory, buildsNewInstances, .description = "Each call to a factory builds a new instance.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Singleton<>;
+    using Product = tt::Transient<std::shared_ptr<Dependency>>;
+    using TestClass = tt::Transient<Factory<Product>>;
+
+    container
+        .addType<Transient<TestClass>, Factory<Product>>()
+        .addType<Transient<Product>, Dependency>()
+        .addType<Singleton<Dependency>>()
+    ;
+
+    container.getInstance<TestClass>();
+    cr_assert_eq(Product::getCount(), 0, "Product should not be built yet. Built %d time(s)", Product::getCount());
+
+    Factory<Product> factory(container);
+    std::shared_ptr<Product> ptr = factory();
+    std::shared_ptr<Product> ptr2 = factory();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr != ptr2, "Returned pointers should refer to different objects.");
+    cr_assert_eq(Product::getCount(), 2, "Product should be built exactly two times. Built %d time(s)", Product::getCount());
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+}
+
+Test(InjectFactory, keepsBuilder, .description = "A factory keeps the builder registered when it was created.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    class First: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 1; }
+    };
+
+    class Second: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 2; }
+    };
+
+    container.addType<Transient<tt::Interface<0>, First>>();
+
+    Factory<tt::Interface<0>> factory(container);
+
+    container.addType<Transient<tt::Interface<0>, Second>>();
+
+    cr_assert_eq(factory()->getDiscr(), 1, "Factory should use the builder it was created with.");
+    cr_assert_eq(container.getInstance<tt::Interface<0>>()->getDiscr(), 2, "Container should use the new builder.");
+}
+
+Test(InjectFactory, lambdaBuilder, .description = "Factories work with builders that only support buildPtr.", .disabled = false) {
+    clonixin::Container container;
+
+    using TestClass = tt::Transient<int>;
+
+    auto lambda = [](clonixin::Container const &, bool) -> std::any { return std::make_shared<TestClass>(42); };
+
+    container.addTransient(std::make_unique<clonixin::builders::LambdaBuilder<decltype(lambda)>>(typeid(TestClass), lambda));
+
+    Factory<TestClass> factory(container);
+
+    cr_assert(bool(factory()), "Returned pointer should not be NULL.");
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(InjectFactory, arena, .description = "Instances built by a factory within an arena scope are allocated from it.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    struct Empty {};
+
+    container.addType<Transient<Empty>>();
+
+    Factory<Empty> factory(container);
+    alignas(std::max_align_t) std::byte buffer[1024];
+    clonixin::ArenaScope arena(buffer, sizeof(buffer));
+
+    auto *p = reinterpret_cast<std::byte *>(factory().get());
+
+    cr_assert(p >= buffer && p < buffer + sizeof(buffer), "Instance should be allocated from the arena.");
+}
+
+Test(InjectFactory, errors, .description = "Creating a factory for a type neither transient nor pooled throws.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Singleton<TestClass>>();
+
+    cr_assert_throw(Factory<TestClass>{container}, ContainerException<ContainerError::BadLifetime>,
+            "Should throw a BadLifetime exception.");
+    cr_assert_throw(Factory<tt::Transient<>>{container}, ContainerException<ContainerError::TypeNotFound>,
+            "Should throw a TypeNotFound exception.");
+}
+
+Test(InjectFactory, staticContainer, .description = "Factories can be injected from a StaticContainer.", .disabled = false) {
+    using namespace clonixin::type_desc;
+    using Product = tt::Transient<>;
+
+    struct TestClass {
+        TestClass(Factory<Product> f): factory(std::move(f)) {}
+
+        Factory<Product> factory;
+    };
+
+    clonixin::StaticContainer<
+        Transient<Product>,
+        With<Transient<TestClass>, Factory<Product>>
+    > container;
+
+    std::shared_ptr<TestClass> ptr = container.get<TestClass>();
+
+    cr_assert(ptr->factory() != ptr->factory(), "Returned pointers should refer to different objects.");
+    cr_assert_eq(Product::getCount(), 2, "Product should be built exactly two times. Built %d time(s)", Product::getCount());
+}
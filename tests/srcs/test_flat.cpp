@@ -0,0 +1,159 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    class CountingResource : public std::pmr::memory_resource {
+        public:
+            int allocations = 0;
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t align) override {
+                ++allocations;
+                return std::pmr::new_delete_resource()->allocate(bytes, align);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+    };
+
+    struct Shared {};
+
+    struct Leaf {
+        Leaf(std::shared_ptr<Shared> shared): shared(std::move(shared)) {}
+
+        std::shared_ptr<Shared> shared;
+    };
+
+    struct Value {
+        Value(std::shared_ptr<Leaf> leaf): leaf(std::move(leaf)) {}
+
+        std::shared_ptr<Leaf> leaf;
+    };
+
+    class Impl: public tt::Interface<0> {
+        public:
+            Impl(std::shared_ptr<Leaf> leaf): leaf(std::move(leaf)) {}
+
+            int getDiscr() const override { return 4; }
+
+            std::shared_ptr<Leaf> leaf;
+    };
+
+    struct Root {
+        Root(std::shared_ptr<tt::Interface<0>> iface, Value &&value): iface(std::move(iface)), value(std::move(value)) {}
+
+        std::shared_ptr<tt::Interface<0>> iface;
+        Value value;
+    };
+
+    using namespace clonixin::type_desc;
+
+    using Set = clonixin::RegistrationSet<
+        Singleton<Shared>,
+        With<Transient<Leaf>, Shared>,
+        With<Transient<Value>, Leaf>,
+        With<Transient<tt::Interface<0>, Impl>, Leaf>,
+        With<Transient<Root>, tt::Interface<0>, Value &&>
+    >;
+}
+
+TestSuite(ContainerFlat, .description = "Testing transients of registration sets built in place.", .disabled = false);
+
+Test(ContainerFlat, builders, .description = "Transients needing transients of their set get a FlatBuilder.", .disabled = false) {
+    clonixin::Container container;
+
+    container.addTypes<Set>();
+
+    using clonixin::builders::FlatBuilder;
+    using clonixin::utils::typeId;
+    using RootBuilder = FlatBuilder<Root, Root, Set::registrations, tt::Interface<0>, Value &&>;
+    using ImplBuilder = FlatBuilder<tt::Interface<0>, Impl, Set::registrations, Leaf>;
+    using LeafBuilder = FlatBuilder<Leaf, Leaf, Set::registrations, Shared>;
+
+    cr_assert(dynamic_cast<RootBuilder const *>(container.getTransientBuilder(typeId<Root>()).get()),
+            "Root should be flattened.");
+    cr_assert(dynamic_cast<ImplBuilder const *>(container.getTransientBuilder(typeId<tt::Interface<0>>()).get()),
+            "Impl should be flattened.");
+    cr_assert_not(dynamic_cast<LeafBuilder const *>(container.getTransientBuilder(typeId<Leaf>()).get()),
+            "Leaf only needs a singleton.");
+}
+
+Test(ContainerFlat, resolve, .description = "Flattened transients are new instances, sharing the singletons.", .disabled = false) {
+    clonixin::Container container;
+
+    container.addTypes<Set>();
+
+    auto root = container.getInstance<Root>();
+    auto other = container.getInstance<Root>();
+    auto value = container.resolve<Root>();
+    auto shared = container.getInstance<Shared>();
+    auto const *impl = dynamic_cast<Impl const *>(root->iface.get());
+
+    cr_assert(impl, "The interface should be built as its implementation.");
+    cr_assert(impl->leaf != root->value.leaf, "Each Leaf should be a new instance.");
+    cr_assert(root->value.leaf != other->value.leaf, "Each Root should get new dependencies.");
+    cr_assert(impl->leaf->shared == shared, "Singletons should be requested to the container.");
+    cr_assert(root->value.leaf->shared == shared, "Singletons should be requested to the container.");
+    cr_assert(value.value.leaf->shared == shared, "Singletons should be requested to the container.");
+}
+
+Test(ContainerFlat, inPlace, .description = "Transients of the set are built without requesting them.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+
+    int requested = 0;
+    auto buildLeaf = [&requested](clonixin::Container const &c, bool) -> std::any {
+        ++requested;
+        return std::make_shared<Leaf>(c.getInstance<Shared>());
+    };
+
+    container
+        .addTypes<Set>()
+        .addTransient(std::make_unique<LambdaBuilder<decltype(buildLeaf)>>(typeid(Leaf), buildLeaf))
+    ;
+
+    container.getInstance<Root>();
+    cr_assert_eq(requested, 0, "Leaf should be built in place. Requested %d time(s)", requested);
+
+    container.getInstance<Leaf>();
+    cr_assert_eq(requested, 1, "Leaf should be built by its new builder. Requested %d time(s)", requested);
+}
+
+Test(ContainerFlat, resources, .description = "Transients built in place are allocated as their parent.", .disabled = false) {
+    CountingResource transients;
+    clonixin::Container container;
+
+    container
+        .setTransientResource(&transients)
+        .addTypes<Set>()
+    ;
+
+    auto root = container.getInstance<Root>();
+
+    cr_assert_eq(transients.allocations, 4, "Root, Impl and both Leaf should be allocated from the resource. Allocated %d time(s)", transients.allocations);
+
+    {
+        clonixin::ArenaScope arena;
+        int before = transients.allocations;
+
+        container.getInstance<Root>();
+        cr_assert_eq(transients.allocations, before, "Transients should be allocated from the arena.");
+    }
+}
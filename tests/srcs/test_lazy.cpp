@@ -0,0 +1,126 @@
+#include <criterion/criterion.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+using clonixin::inject::Lazy;
+
+namespace {
+    std::atomic<int> heavyBuilt;
+
+    struct Heavy {
+        Heavy() {
+            ++heavyBuilt;
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    };
+
+    struct CycleB;
+
+    struct CycleA {
+        CycleA(Lazy<CycleB> b): b(std::move(b)) {}
+
+        Lazy<CycleB> b;
+    };
+
+    struct CycleB {
+        CycleB(std::shared_ptr<CycleA> a): a(std::move(a)) {}
+
+        std::shared_ptr<CycleA> a;
+    };
+}
+
+TestSuite(InjectLazy, .description = "Testing lazy dependencies.", .disabled = false);
+
+Test(InjectLazy, resolvedOnFirstUse, .description = "A lazy dependency is only built when dereferenced, then kept.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Transient<>;
+    using TestClass = tt::Transient<Lazy<Dependency>>;
+
+    container
+        .addType<Transient<TestClass>, Lazy<Dependency>>()
+        .addType<Transient<Dependency>>()
+    ;
+
+    Lazy<Dependency> lazy(container);
+    Lazy<Dependency> copy = lazy;
+
+    container.getInstance<TestClass>();
+    cr_assert_eq(Dependency::getCount(), 0, "Dependency should not be built yet. Built %d time(s)", Dependency::getCount());
+
+    std::shared_ptr<Dependency> ptr = lazy.get();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(copy.get() == ptr, "Copies should share the instance.");
+    cr_assert(&*lazy == ptr.get(), "Dereferencing should return the same instance.");
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+}
+
+Test(InjectLazy, breaksCycles, .description = "Lazy dependencies can close a dependency cycle.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .addType<Singleton<CycleA>, Lazy<CycleB>>()
+        .addType<Singleton<CycleB>, CycleA>()
+    ;
+
+    auto timings = container.warmUp();
+    std::shared_ptr<CycleB> b = container.getInstance<CycleB>();
+
+    cr_assert_eq(timings.size(), 2, "Both singletons should be warmed up. Built %zu.", timings.size());
+    cr_assert(b->a->b.get() == b, "The lazy dependency should resolve to the singleton.");
+}
+
+Test(InjectLazy, concurrentResolution, .description = "Threads dereferencing the same handle resolve it once.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    heavyBuilt = 0;
+    container.addType<Transient<Heavy>>();
+
+    Lazy<Heavy> lazy(container);
+    std::vector<std::shared_ptr<Heavy>> ptrs(8);
+    std::vector<std::thread> threads;
+
+    for (auto &p: ptrs)
+        threads.emplace_back([&lazy, &p]() { p = lazy.get(); });
+    for (auto &t: threads)
+        t.join();
+
+    cr_assert_eq(heavyBuilt.load(), 1, "Heavy should be built exactly once. Built %d time(s)", heavyBuilt.load());
+    for (auto &p: ptrs)
+        cr_assert(p == ptrs[0], "Returned pointers should be equals.");
+}
+
+Test(InjectLazy, staticContainer, .description = "Lazy dependencies can be resolved from a StaticContainer.", .disabled = false) {
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Singleton<>;
+
+    struct TestClass {
+        TestClass(Lazy<Dependency> d): dep(std::move(d)) {}
+
+        Lazy<Dependency> dep;
+    };
+
+    clonixin::StaticContainer<
+        Singleton<Dependency>,
+        With<Transient<TestClass>, Lazy<Dependency>>
+    > container;
+
+    std::shared_ptr<TestClass> ptr = container.get<TestClass>();
+
+    cr_assert_eq(Dependency::getCount(), 0, "Dependency should not be built yet. Built %d time(s)", Dependency::getCount());
+    cr_assert(ptr->dep.get() == container.get<Dependency>(), "The lazy dependency should resolve to the singleton.");
+}
@@ -0,0 +1,93 @@
+#include <criterion/criterion.h>
+
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+using namespace clonixin::utils::literals;
+using clonixin::inject::Named;
+
+namespace {
+    struct Pool {
+        Pool(int size): size(size) {}
+
+        int size;
+    };
+
+    struct Repository {
+        Repository(Named<Pool, "primary"_key> primary, std::shared_ptr<Pool> replica)
+        : primary(primary.get()), replica(std::move(replica)) {}
+
+        std::shared_ptr<Pool> primary;
+        std::shared_ptr<Pool> replica;
+    };
+}
+
+TestSuite(ContainerNamed, .description = "Testing keyed registrations.", .disabled = false);
+
+Test(ContainerNamed, keysAreDistinct, .description = "Each key resolves to its own registration.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::utils::value;
+    using clonixin::tag::key;
+
+    container
+        .addType<Singleton<Pool>, Int<4>>(key<"primary"_key>)
+        .addType<Singleton<Pool>, Int<1>>(key<"replica"_key>)
+    ;
+
+    auto primary = container.getInstance<Pool>(key<"primary"_key>);
+    auto replica = container.getInstance<Pool>(key<"replica"_key>);
+
+    cr_assert_eq(primary->size, 4, "Wrong registration used for the primary pool.");
+    cr_assert_eq(replica->size, 1, "Wrong registration used for the replica pool.");
+    cr_assert(primary == container.getInstance<Pool>(key<"primary"_key>), "Keyed singletons should be shared.");
+    cr_assert_throw(container.getInstance<Pool>(), clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::TypeNotFound>,
+            "Unkeyed requests should not use keyed registrations.");
+}
+
+Test(ContainerNamed, keyHash, .description = "Keys are hashed at compile time.", .disabled = false) {
+    static_assert("primary"_key == clonixin::utils::keyHash("primary", 7), "Literal and function hashes differ.");
+    static_assert("primary"_key != "replica"_key, "Different keys should not collide.");
+
+    auto keyed = clonixin::utils::keyedTypeId<Pool, "primary"_key>();
+
+    cr_assert_neq(keyed, clonixin::utils::typeId<Pool>(), "Keyed and unkeyed types should have different ids.");
+}
+
+Test(ContainerNamed, injected, .description = "Named<T, K> hands the keyed instance to a constructor.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::utils::value;
+    using clonixin::tag::key;
+
+    container
+        .addType<Singleton<Pool>, Int<4>>(key<"primary"_key>)
+        .addType<Singleton<Pool>, Int<1>>(key<"replica"_key>)
+        .addType<Transient<Repository>, Named<Pool, "primary"_key>, Named<Pool, "replica"_key>>()
+    ;
+
+    auto repository = container.getInstance<Repository>();
+
+    cr_assert_eq(repository->primary->size, 4, "Wrong primary pool injected.");
+    cr_assert_eq(repository->replica->size, 1, "Wrong replica pool injected.");
+}
+
+Test(ContainerNamed, instances, .description = "Instances can be registered under a key.", .disabled = false) {
+    clonixin::Container container;
+
+    using clonixin::tag::key;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container.addInstance(std::make_unique<Pool>(8), key<"primary"_key>);
+
+    cr_assert_eq(container.getInstance<Pool>(key<"primary"_key>)->size, 8, "Keyed instance not returned.");
+    cr_assert_throw(container.addInstance(std::make_unique<Pool>(2), key<"primary"_key>, dup::once),
+            clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::DuplicateType>,
+            "Registering a key twice with once should throw.");
+}
@@ -0,0 +1,225 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    class CountingResource : public std::pmr::memory_resource {
+        public:
+            int allocations = 0;
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t align) override {
+                ++allocations;
+                return std::pmr::new_delete_resource()->allocate(bytes, align);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+    };
+
+    struct Shared {};
+
+    struct Leaf {
+        Leaf(std::shared_ptr<Shared> shared): shared(std::move(shared)) {}
+
+        std::shared_ptr<Shared> shared;
+    };
+
+    class Impl: public tt::Interface<0> {
+        public:
+            Impl(std::shared_ptr<Leaf> leaf): leaf(std::move(leaf)) {}
+
+            int getDiscr() const override { return 5; }
+
+            std::shared_ptr<Leaf> leaf;
+    };
+
+    struct Root {
+        Root(std::shared_ptr<Leaf> first, std::shared_ptr<Leaf> second, std::shared_ptr<tt::Interface<0>> iface)
+        : first(std::move(first)), second(std::move(second)), iface(std::move(iface)) {}
+
+        std::shared_ptr<Leaf> first;
+        std::shared_ptr<Leaf> second;
+        std::shared_ptr<tt::Interface<0>> iface;
+    };
+
+    struct Left;
+    struct Right;
+
+    struct Left {
+        Left(std::shared_ptr<Right>) {}
+    };
+
+    struct Right {
+        Right(std::shared_ptr<Left>) {}
+    };
+
+    template <int N>
+    struct Link {
+        Link() = default;
+        template <class T>
+        Link(std::shared_ptr<T>) {}
+    };
+
+    template <int... Ns>
+    void addLinks(clonixin::Container &c, std::integer_sequence<int, Ns...>) {
+        using namespace clonixin::type_desc;
+
+        (c.addType<Transient<Link<Ns>>, Link<Ns + 1>>(), ...);
+    }
+
+    void addRoot(clonixin::Container &c) {
+        using namespace clonixin::type_desc;
+
+        c
+            .addType<Singleton<Shared>>()
+            .addType<Transient<Leaf>, Shared>()
+            .addType<Transient<tt::Interface<0>, Impl>, Leaf>()
+            .addType<Transient<Root>, Leaf, Leaf, tt::Interface<0>>()
+        ;
+    }
+}
+
+TestSuite(ContainerPlan, .description = "Testing precompiled resolution plans.", .disabled = false);
+
+Test(ContainerPlan, resolve, .description = "A plan builds new transients, and shares singletons.", .disabled = false) {
+    clonixin::Container container;
+
+    addRoot(container);
+
+    auto plan = container.compilePlan<Root>();
+    auto root = plan();
+    auto other = plan();
+    auto shared = container.getInstance<Shared>();
+    auto const *impl = dynamic_cast<Impl const *>(root->iface.get());
+
+    cr_assert(impl, "The interface should be built as its implementation.");
+    cr_assert(root != other, "Each run should build a new instance.");
+    cr_assert(root->first != root->second, "Each Leaf should be a new instance.");
+    cr_assert(root->first != other->first, "Each run should build new dependencies.");
+    cr_assert(root->first->shared == shared, "Singletons should be requested to the container.");
+    cr_assert(impl->leaf->shared == shared, "Singletons should be requested to the container.");
+}
+
+Test(ContainerPlan, stats, .description = "A plan reports its shape and usage.", .disabled = false) {
+    clonixin::Container container;
+
+    addRoot(container);
+
+    auto plan = container.compilePlan<Root>();
+
+    plan();
+    plan();
+
+    auto stats = plan.getStats();
+
+    cr_assert_eq(stats.steps, 5, "Root, Impl and three Leaf should be built by the plan, not %zu.", stats.steps);
+    cr_assert_eq(stats.boundaries, 3, "Each Leaf should request Shared, not %zu.", stats.boundaries);
+    cr_assert_eq(stats.depth, 3, "Root, Impl and Leaf should be chained, not %zu.", stats.depth);
+    cr_assert_eq(stats.compilations, 1, "The plan should be compiled once, not %zu.", stats.compilations);
+    cr_assert_eq(stats.runs, 2, "The plan should have run twice, not %zu.", stats.runs);
+}
+
+Test(ContainerPlan, invalidation, .description = "Registering a type compiles the plan again.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+
+    addRoot(container);
+
+    auto plan = container.compilePlan<Root>();
+    int requested = 0;
+    auto buildLeaf = [&requested](clonixin::Container const &c, bool) -> std::any {
+        ++requested;
+        return std::make_shared<Leaf>(c.getInstance<Shared>());
+    };
+
+    plan();
+    container.addTransient(std::make_unique<LambdaBuilder<decltype(buildLeaf)>>(typeid(Leaf), buildLeaf));
+    plan();
+
+    auto stats = plan.getStats();
+
+    cr_assert_eq(requested, 3, "The new Leaf builder should be used. Requested %d time(s)", requested);
+    cr_assert_eq(stats.compilations, 2, "The plan should be compiled again, not %zu time(s).", stats.compilations);
+    cr_assert_eq(stats.steps, 2, "Only Root and Impl should be left to the plan, not %zu.", stats.steps);
+}
+
+Test(ContainerPlan, fallback, .description = "Types a plan cannot build are requested to the container.", .disabled = false) {
+    clonixin::Container container;
+
+    addRoot(container);
+
+    auto plan = container.compilePlan<Shared>();
+
+    cr_assert(plan() == container.getInstance<Shared>(), "The singleton should be returned.");
+    cr_assert_eq(plan.getStats().steps, 0, "A singleton should not be built by the plan.");
+}
+
+Test(ContainerPlan, deepChain, .description = "Deep chains are built without recursing.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    addLinks(container, std::make_integer_sequence<int, 200>{});
+    container.addType<Transient<Link<200>>>();
+
+    auto plan = container.compilePlan<Link<0>>();
+
+    cr_assert(plan() != nullptr, "A deep chain should resolve.");
+    cr_assert_eq(plan.getStats().depth, 201, "Every link should be built by the plan.");
+}
+
+Test(ContainerPlan, cycle, .description = "A cycle is reported when the plan runs.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Transient<Left>, Right>()
+        .addType<Transient<Right>, Left>()
+    ;
+
+    auto plan = container.compilePlan<Left>();
+
+    cr_assert_eq(plan.getStats().boundaries, 1, "The cycle should be left to the container.");
+    cr_assert_throw(plan(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerPlan, resources, .description = "Instances built by a plan are allocated as transients.", .disabled = false) {
+    CountingResource transients;
+    clonixin::Container container;
+
+    container.setTransientResource(&transients);
+    addRoot(container);
+
+    auto plan = container.compilePlan<Root>();
+    auto root = plan();
+
+    cr_assert_eq(transients.allocations, 5, "Every transient should be allocated from the resource. Allocated %d time(s)", transients.allocations);
+
+    {
+        clonixin::ArenaScope arena;
+        int before = transients.allocations;
+
+        plan();
+        cr_assert_eq(transients.allocations, before, "Transients should be allocated from the arena.");
+    }
+}
@@ -0,0 +1,217 @@
+#include <criterion/criterion.h>
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    std::atomic<int> resetCount;
+
+    struct Resettable {
+        int value = 0;
+
+        void reset() {
+            value = 0;
+            ++resetCount;
+        }
+    };
+
+    struct Counted {
+        static std::atomic<int> alive;
+
+        Counted() { ++alive; }
+        ~Counted() { --alive; }
+    };
+
+    std::atomic<int> Counted::alive = 0;
+}
+
+TestSuite(ContainerPooled, .description = "Testing pooled lifetime.", .disabled = false);
+
+Test(ContainerPooled, reusedAfterRelease, .description = "A released pooled instance is handed out again.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Transient<>;
+
+    container.addType<Pooled<TestClass>>();
+
+    TestClass *raw = nullptr;
+    {
+        std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+        std::shared_ptr<TestClass> ptr2 = container.getInstance<TestClass>();
+
+        cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+        cr_assert(ptr != ptr2, "Instances in use should be distinct.");
+        raw = ptr.get();
+        ptr2.reset();
+    }
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+    auto stats = container.getPoolStats<TestClass>();
+
+    cr_assert(ptr.get() == raw, "The last released instance should be reused.");
+    cr_assert_eq(stats.misses, 2, "Two instances should have been built. Built %zu.", stats.misses);
+    cr_assert_eq(stats.hits, 1, "One request should have been served from the pool. Served %zu.", stats.hits);
+    cr_assert_eq(stats.idle, 1, "One instance should be idle. Found %zu.", stats.idle);
+}
+
+Test(ContainerPooled, resetHook, .description = "Instances are reset before being put back into the pool.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    resetCount = 0;
+    container.addType<Pooled<Resettable>>();
+
+    container.getInstance<Resettable>()->value = 42;
+
+    cr_assert_eq(resetCount.load(), 1, "reset() should be called once. Called %d time(s).", resetCount.load());
+    cr_assert_eq(container.getInstance<Resettable>()->value, 0, "Reused instance should be reset.");
+}
+
+Test(ContainerPooled, boundedPool, .description = "A pool keeps at most N idle instances.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    Counted::alive = 0;
+    container.addType<Pooled<Counted, 2>>();
+
+    {
+        std::vector<std::shared_ptr<Counted>> ptrs;
+
+        for (int i = 0; i < 5; ++i)
+            ptrs.push_back(container.getInstance<Counted>());
+        cr_assert_eq(Counted::alive.load(), 5, "Five instances should be alive.");
+    }
+
+    auto stats = container.getPoolStats<Counted>();
+
+    cr_assert_eq(Counted::alive.load(), 2, "Only two instances should be kept. Kept %d.", Counted::alive.load());
+    cr_assert_eq(stats.idle, 2, "Two instances should be idle. Found %zu.", stats.idle);
+    cr_assert_eq(stats.capacity, 2, "Capacity should be 2. Found %zu.", stats.capacity);
+}
+
+Test(ContainerPooled, pooledInterface, .description = "A pooled implementation is returned through its interface.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using clonixin::utils::value::Int;
+
+    class TestClass: public tt::Interface<0> {
+        public:
+            TestClass(int i): _i(i) {}
+            int getDiscr() const override { return _i; }
+        private:
+            int _i;
+    };
+
+    container.addType<Pooled<tt::Interface<0>, 4, TestClass>, Int<42>>();
+
+    std::shared_ptr<tt::Interface<0>> ptr = container.getInstance<tt::Interface<0>>();
+
+    cr_assert_eq(ptr->getDiscr(), 42, "Direct value was not passed to the constructor.");
+    cr_assert_throw(container.getInstance<tt::Interface<0> &&>(), ContainerException<ContainerError::BadLifetime>,
+            "Should throw a BadLifetime exception.");
+}
+
+Test(ContainerPooled, notPooled, .description = "Asking pool statistics of a type that is not pooled throws.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using TestClass = tt::Transient<>;
+
+    container.addType<Transient<TestClass>>();
+
+    cr_assert_throw(container.getPoolStats<TestClass>(), ContainerException<ContainerError::BadLifetime>,
+            "Should throw a BadLifetime exception.");
+}
+
+Test(ContainerPooled, concurrentUse, .description = "Pooled instances can be requested and released from several threads.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    Counted::alive = 0;
+    container.addType<Pooled<Counted, 8>>();
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < 8; ++i)
+        threads.emplace_back([&container]() {
+            for (int j = 0; j < 1000; ++j)
+                container.getInstance<Counted>();
+        });
+    for (auto &t: threads)
+        t.join();
+
+    auto stats = container.getPoolStats<Counted>();
+
+    cr_assert_eq(stats.hits + stats.misses, 8000, "Every request should be counted.");
+    cr_assert(stats.misses <= 8, "At most one instance per thread should be built. Built %zu.", stats.misses);
+    cr_assert(stats.idle <= 8, "At most 8 instances should be idle. Found %zu.", stats.idle);
+}
+
+Test(ContainerPooled, destroyedWithContainer, .description = "Idle instances are destroyed with their container, in use ones once released.", .disabled = false) {
+    using namespace clonixin::type_desc;
+
+    Counted::alive = 0;
+
+    std::shared_ptr<Counted> inUse;
+    {
+        clonixin::Container container;
+
+        container.addType<Pooled<Counted, 8>>();
+        inUse = container.getInstance<Counted>();
+        container.getInstance<Counted>();
+
+        cr_assert_eq(container.getPoolStats<Counted>().idle, 1, "The released instance should be idle.");
+    }
+
+    cr_assert_eq(Counted::alive.load(), 1, "The idle instance should be destroyed. %d alive.", Counted::alive.load());
+
+    inUse.reset();
+    cr_assert_eq(Counted::alive.load(), 0, "Released instances should be destroyed. %d alive.", Counted::alive.load());
+}
+
+Test(ContainerPooled, destroyedFromOtherThread, .description = "Other threads drop the idle instances of a destroyed container.", .disabled = false) {
+    using namespace clonixin::type_desc;
+
+    Counted::alive = 0;
+
+    auto container = std::make_unique<clonixin::Container>();
+    clonixin::Container other;
+    std::promise<void> parked;
+    std::promise<void> destroyed;
+    int aliveAfter = -1;
+
+    container->addType<Pooled<Counted, 8>>();
+    other.addType<Pooled<Counted, 8>>();
+
+    std::thread worker([&]() {
+        container->getInstance<Counted>();
+        parked.set_value();
+        destroyed.get_future().wait();
+
+        auto ptr = other.getInstance<Counted>();
+        aliveAfter = Counted::alive.load();
+    });
+
+    parked.get_future().wait();
+    container.reset();
+    destroyed.set_value();
+    worker.join();
+
+    cr_assert_eq(aliveAfter, 1, "Only the new instance should be alive. %d alive.", aliveAfter);
+}
@@ -0,0 +1,89 @@
+#include <criterion/criterion.h>
+
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct Leaf {};
+
+    struct Node {
+        Node(std::shared_ptr<Leaf> leaf): leaf(std::move(leaf)) {}
+
+        std::shared_ptr<Leaf> leaf;
+    };
+
+    struct Owner {
+        Owner(Leaf &&) {}
+    };
+
+    struct CycleB;
+
+    struct CycleA {
+        CycleA(std::shared_ptr<CycleB>) {}
+    };
+
+    struct CycleB {
+        CycleB(std::shared_ptr<CycleA>) {}
+        CycleB(clonixin::inject::Lazy<CycleA>) {}
+    };
+
+    class Impl: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 1; }
+    };
+
+    using namespace clonixin::type_desc;
+}
+
+TestSuite(RegistrationSet, .description = "Testing compile-time validation of registrations.", .disabled = false);
+
+Test(RegistrationSet, complete, .description = "Missing dependencies are detected.", .disabled = false) {
+    using Valid = clonixin::RegistrationSet<Transient<Leaf>, With<Transient<Node>, Leaf>>;
+    using Missing = clonixin::RegistrationSet<With<Transient<Node>, Leaf>>;
+
+    static_assert(Valid::isValid(), "A complete set should be valid.");
+    static_assert(Valid::validate(), "A complete set should be valid.");
+    static_assert(!Missing::isComplete(), "Leaf is not registered.");
+    static_assert(clonixin::RegistrationSet<>::isValid(), "An empty set should be valid.");
+    static_assert(clonixin::RegistrationSet<With<Transient<Node>, clonixin::inject::All<Leaf>>>::isComplete(),
+            "All<T> accepts an empty list.");
+}
+
+Test(RegistrationSet, acyclic, .description = "Dependency cycles are detected, unless broken by Lazy.", .disabled = false) {
+    using Cycle = clonixin::RegistrationSet<With<Transient<CycleA>, CycleB>, With<Transient<CycleB>, CycleA>>;
+    using Broken = clonixin::RegistrationSet<With<Transient<CycleA>, CycleB>, With<Transient<CycleB>, clonixin::inject::Lazy<CycleA>>>;
+
+    static_assert(Cycle::isComplete() && !Cycle::isAcyclic(), "The cycle should be detected.");
+    static_assert(Broken::isAcyclic(), "Lazy dependencies should not count as cycles.");
+}
+
+Test(RegistrationSet, captive, .description = "Singletons keeping shorter-lived instances are detected.", .disabled = false) {
+    using Captive = clonixin::RegistrationSet<Transient<Leaf>, With<Singleton<Node>, Leaf>>;
+    using Owned = clonixin::RegistrationSet<Transient<Leaf>, With<Singleton<Owner>, Leaf &&>>;
+    using Shared = clonixin::RegistrationSet<Singleton<Leaf>, With<Singleton<Node>, Leaf>>;
+
+    static_assert(!Captive::isCaptiveFree(), "A singleton keeping a transient should be detected.");
+    static_assert(Owned::isCaptiveFree(), "A singleton owning a transient by value is allowed.");
+    static_assert(Shared::isCaptiveFree(), "A singleton keeping a singleton is allowed.");
+}
+
+Test(RegistrationSet, addTypes, .description = "A validated set is registered to a container.", .disabled = false) {
+    clonixin::Container container;
+
+    container.addTypes<clonixin::RegistrationSet<
+        Singleton<Leaf>,
+        With<Transient<Node>, Leaf>,
+        Transient<tt::Interface<0>, Impl>,
+        Transient<tt::Interface<0>, Impl>
+    >>();
+
+    auto node = container.getInstance<Node>();
+
+    cr_assert(node->leaf == container.getInstance<Leaf>(), "Leaf should be a singleton.");
+    cr_assert_eq(container.getAll<tt::Interface<0>>().size(), 2, "Repeated types should be appended.");
+}
@@ -0,0 +1,133 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    int moves = 0;
+
+    struct Tracked {
+        Tracked() = default;
+        Tracked(Tracked const &) { ++moves; }
+        Tracked(Tracked &&) noexcept { ++moves; }
+    };
+
+    struct Holder {
+        Holder(Tracked &&t): tracked(std::move(t)) {}
+
+        Tracked tracked;
+    };
+}
+
+TestSuite(ContainerResolve, .description = "Testing value resolution.", .disabled = false);
+
+Test(ContainerResolve, noMove, .description = "Resolved values are built in place.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    moves = 0;
+    container.addType<Transient<Tracked>>();
+
+    Tracked value = container.resolve<Tracked>();
+
+    (void)value;
+    cr_assert_eq(moves, 0, "Tracked should not be copied nor moved. Moved %d time(s).", moves);
+}
+
+Test(ContainerResolve, unmovable, .description = "Unmovable types can be resolved.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::UnMovableTransient<>;
+
+    container.addType<Transient<TestClass>>();
+
+    TestClass value = container.resolve<TestClass>();
+
+    (void)value;
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerResolve, rvalueDependency, .description = "Rvalue reference arguments are resolved in place.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    moves = 0;
+    container
+        .addType<Transient<Holder>, Tracked &&>()
+        .addType<Transient<Tracked>>()
+    ;
+
+    container.getInstance<Holder>();
+    cr_assert_eq(moves, 1, "Tracked should only be moved into its member. Moved %d time(s).", moves);
+}
+
+Test(ContainerResolve, lambdaBuilder, .description = "Values built by a custom builder are moved out of std::any.", .disabled = false) {
+    clonixin::Container container;
+
+    using TestClass = tt::Transient<int>;
+
+    auto lambda = [](clonixin::Container const &, bool val) -> std::any {
+        if (val)
+            return std::make_any<TestClass>(42);
+        return std::make_shared<TestClass>(42);
+    };
+
+    container.addTransient(std::make_unique<clonixin::builders::LambdaBuilder<decltype(lambda)>>(typeid(TestClass), lambda));
+
+    TestClass value = container.resolve<TestClass>();
+
+    (void)value;
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerResolve, errors, .description = "Resolving a type that is not transient throws.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using TestClass = tt::Transient<>;
+
+    container.addType<Singleton<TestClass>>();
+
+    cr_assert_throw(container.resolve<TestClass>(), ContainerException<ContainerError::BadLifetime>,
+            "Should throw a BadLifetime exception.");
+    cr_assert_throw(container.resolve<tt::Transient<int>>(), ContainerException<ContainerError::TypeNotFound>,
+            "Should throw a TypeNotFound exception.");
+}
+
+Test(ContainerResolve, unmovableErrors, .description = "Unmovable types that cannot be built in place throw without being built.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using Custom = tt::UnMovableTransient<>;
+    using Shared = tt::UnMovableTransient<int>;
+
+    int built = 0;
+    auto lambda = [&built](clonixin::Container const &, bool) -> std::any {
+        ++built;
+        return std::make_shared<Custom>();
+    };
+
+    container
+        .addTransient(std::make_unique<clonixin::builders::LambdaBuilder<decltype(lambda)>>(typeid(Custom), lambda))
+        .addType<Singleton<Shared>, clonixin::utils::value::Int<42>>()
+    ;
+
+    cr_assert_throw(container.resolve<Custom>(), BuilderException<BuilderError::RvalueUnsupported>,
+            "Should throw a RvalueUnsupported exception.");
+    cr_assert_throw(container.resolve<Shared>(), ContainerException<ContainerError::BadLifetime>,
+            "Should throw a BadLifetime exception.");
+    cr_assert_eq(built, 0, "Custom should not be built. Built %d time(s)", built);
+    cr_assert_eq(Shared::getCount(), 0, "Shared should not be built. Built %d time(s)", Shared::getCount());
+}
@@ -0,0 +1,183 @@
+#include <criterion/criterion.h>
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    class CountingResource : public std::pmr::memory_resource {
+        public:
+            int allocations = 0;
+            int deallocations = 0;
+
+        private:
+            void *do_allocate(std::size_t bytes, std::size_t align) override {
+                ++allocations;
+                return std::pmr::new_delete_resource()->allocate(bytes, align);
+            }
+
+            void do_deallocate(void *p, std::size_t bytes, std::size_t align) override {
+                ++deallocations;
+                std::pmr::new_delete_resource()->deallocate(p, bytes, align);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const &other) const noexcept override {
+                return this == &other;
+            }
+    };
+
+    class Impl: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 3; }
+    };
+
+    struct Dependency {};
+}
+
+TestSuite(ContainerResource, .description = "Testing container memory resources.", .disabled = false);
+
+Test(ContainerResource, singletons, .description = "Singletons are allocated from the singleton resource only.", .disabled = false) {
+    CountingResource singletons;
+
+    {
+        clonixin::Container container;
+
+        using namespace clonixin::type_desc;
+
+        container
+            .setSingletonResource(&singletons)
+            .addType<Singleton<tt::Interface<0>, Impl>>()
+            .addType<Transient<Dependency>>()
+        ;
+
+        cr_assert(container.getInstance<tt::Interface<0>>() == container.getInstance<tt::Interface<0>>(),
+                "Returned pointers should be equals.");
+        container.getInstance<Dependency>();
+        cr_assert_eq(singletons.allocations, 1, "Expected a single allocation, got %d.", singletons.allocations);
+    }
+
+    cr_assert_eq(singletons.deallocations, 1, "The singleton should be released to the resource.");
+}
+
+Test(ContainerResource, transients, .description = "Transients are allocated from the transient resource, typed or not.", .disabled = false) {
+    clonixin::Container container;
+    CountingResource transients;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .setTransientResource(&transients)
+        .addType<Transient<tt::Interface<0>, Impl>>()
+        .addType<Transient<Dependency>>()
+        .addType<Singleton<tt::Singleton<>>>()
+    ;
+
+    container.getInstance<tt::Interface<0>>();
+    container.getInstance<Dependency>();
+    container.getInstance(clonixin::tag::container::ptr, std::type_index(typeid(Dependency)));
+    container.getInstance<tt::Singleton<>>();
+
+    cr_assert_eq(transients.allocations, 3, "Expected one allocation per transient, got %d.", transients.allocations);
+    cr_assert_eq(container.getTransientResource(), &transients, "Transient resource was not kept.");
+}
+
+Test(ContainerResource, arenaFirst, .description = "An arena scope takes precedence over the transient resource.", .disabled = false) {
+    clonixin::Container container;
+    CountingResource transients;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .setTransientResource(&transients)
+        .addType<Transient<Dependency>>()
+    ;
+
+    {
+        clonixin::ArenaScope arena;
+
+        container.getInstance<Dependency>();
+    }
+
+    cr_assert_eq(transients.allocations, 0, "Transient should be allocated from the arena, got %d allocation(s).", transients.allocations);
+}
+
+Test(ContainerResource, instanceControlBlock, .description = "The control block of registered instances comes from the singleton resource.", .disabled = false) {
+    CountingResource singletons;
+
+    {
+        clonixin::Container container;
+
+        container
+            .setSingletonResource(&singletons)
+            .addInstance(std::make_unique<Dependency>())
+        ;
+
+        cr_assert(bool(container.getInstance<Dependency>()), "Returned pointer should not be NULL.");
+        cr_assert_eq(singletons.allocations, 1, "Expected the control block to be allocated, got %d.", singletons.allocations);
+    }
+
+    cr_assert_eq(singletons.deallocations, 1, "The control block should be released to the resource.");
+}
+
+Test(ContainerResource, factory, .description = "Factories allocate from the transient resource.", .disabled = false) {
+    clonixin::Container container;
+    CountingResource transients;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .setTransientResource(&transients)
+        .addType<Transient<Dependency>>()
+    ;
+
+    clonixin::inject::Factory<Dependency> make(container);
+
+    make();
+    make();
+    cr_assert_eq(transients.allocations, 2, "Expected one allocation per instance, got %d.", transients.allocations);
+}
+
+Test(ContainerResource, sealed, .description = "Resources cannot be changed once sealed.", .disabled = false) {
+    clonixin::Container container;
+    CountingResource resource;
+
+    container.seal();
+
+    cr_assert_throw(
+        container.setTransientResource(&resource),
+        clonixin::exceptions::ContainerException<clonixin::exceptions::ContainerError::Sealed>,
+        "Setting a resource on a sealed container should throw."
+    );
+}
+
+Test(ContainerResource, bookkeeping, .description = "The container bookkeeping comes from the resource it was given.", .disabled = false) {
+    CountingResource bookkeeping;
+
+    {
+        clonixin::Container container(&bookkeeping);
+
+        using namespace clonixin::type_desc;
+
+        int before = bookkeeping.allocations;
+
+        container
+            .addType<Singleton<tt::Interface<0>, Impl>>()
+            .addType<Cached<Dependency>>()
+            .seal()
+        ;
+
+        cr_assert(bookkeeping.allocations > before, "Registrations should be allocated from the resource.");
+        cr_assert_eq(container.getInstance<tt::Interface<0>>()->getDiscr(), 3, "Instance was not built.");
+        cr_assert(bool(container.getInstance<Dependency>()), "Returned pointer should not be NULL.");
+    }
+
+    cr_assert_eq(bookkeeping.deallocations, bookkeeping.allocations,
+            "Everything allocated from the resource should be released. %d allocation(s), %d deallocation(s).",
+            bookkeeping.allocations, bookkeeping.deallocations);
+}
@@ -0,0 +1,120 @@
+#include <criterion/criterion.h>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct Session {};
+
+    struct Handler {
+        Handler(std::shared_ptr<Session> s): session(std::move(s)) {}
+
+        std::shared_ptr<Session> session;
+    };
+
+    template <int N>
+    struct LongLived {
+        LongLived(std::shared_ptr<Session>) {}
+    };
+}
+
+TestSuite(ContainerScoped, .description = "Testing scoped lifetime.", .disabled = false);
+
+Test(ContainerScoped, sameInstanceInScope, .description = "A scoped type is built once per scope.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Scoped<TestClass>>();
+
+    auto scope = container.createScope();
+    std::shared_ptr<TestClass> ptr = scope.getInstance<TestClass>();
+    std::shared_ptr<TestClass> ptr2 = scope.getInstance<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr == ptr2, "Returned pointers should be equals.");
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerScoped, differentScopes, .description = "Each scope has its own instance, released with the scope.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container.addType<Scoped<Session>>();
+
+    std::weak_ptr<Session> weak;
+    std::shared_ptr<Session> other;
+
+    {
+        auto scope = container.createScope();
+        auto scope2 = container.createScope();
+
+        weak = scope.getInstance<Session>();
+        other = scope2.getInstance<Session>();
+
+        cr_assert_not(weak.lock() == other, "Returned pointers should refer to different objects.");
+        cr_assert_not(weak.expired(), "Instance should be kept by the scope.");
+    }
+
+    cr_assert(weak.expired(), "Instance should be released with the scope.");
+}
+
+Test(ContainerScoped, scopedDependency, .description = "Dependencies built within a scope share its scoped instances.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .addType<Scoped<Session>>()
+        .addType<Transient<Handler>, Session>()
+    ;
+
+    auto scope = container.createScope();
+    auto h1 = scope.getInstance<Handler>();
+    auto h2 = scope.getInstance<Handler>();
+
+    cr_assert_not(h1 == h2, "Transients should refer to different objects.");
+    cr_assert(h1->session == h2->session, "Transients should share the scoped dependency.");
+    cr_assert(h1->session == scope.getInstance<Session>(), "Scoped dependency should be the instance of the scope.");
+}
+
+Test(ContainerScoped, noScope, .description = "Requesting a scoped type outside of a scope throws.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Scoped<Session>>()
+        .addType<Transient<Handler>, Session>()
+    ;
+
+    cr_assert_throw(container.getInstance<Session>(), ContainerException<ContainerError::NoScope>, "Should throw a NoScope exception.");
+    cr_assert_throw(container.getInstance<Handler>(), ContainerException<ContainerError::NoScope>, "Should throw a NoScope exception.");
+}
+
+Test(ContainerScoped, longerLifetime, .description = "Types outliving a scope cannot depend on its scoped instances.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Scoped<Session>>()
+        .addType<Singleton<LongLived<0>>, Session>()
+        .addType<Cached<LongLived<1>>, Session>()
+        .addType<Pooled<LongLived<2>>, Session>()
+    ;
+
+    auto scope = container.createScope();
+
+    cr_assert_throw(scope.getInstance<LongLived<0>>(), ContainerException<ContainerError::NoScope>, "Should throw a NoScope exception.");
+    cr_assert_throw(scope.getInstance<LongLived<1>>(), ContainerException<ContainerError::NoScope>, "Should throw a NoScope exception.");
+    cr_assert_throw(scope.getInstance<LongLived<2>>(), ContainerException<ContainerError::NoScope>, "Should throw a NoScope exception.");
+    cr_assert(scope.getInstance<Session>() != nullptr, "The scope should still build its own instances.");
+}
@@ -0,0 +1,75 @@
+#include <criterion/criterion.h>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+TestSuite(ContainerSealed, .description = "Testing sealed containers.", .disabled = false);
+
+Test(ContainerSealed, resolveAfterSeal, .description = "Types registered before sealing can still be resolved.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Transient<>;
+    using TestClass = tt::Singleton<std::shared_ptr<Dependency>>;
+
+    container
+        .addType<Transient<Dependency>>()
+        .addType<Singleton<TestClass>, Dependency>()
+        .seal()
+    ;
+
+    cr_assert(container.isSealed(), "Container should be sealed.");
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+    std::shared_ptr<TestClass> ptr2 = container.getInstance<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr == ptr2, "Returned pointers should be equals.");
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+}
+
+Test(ContainerSealed, resolveByTypeIndexAfterSeal, .description = "Type-erased lookups work on a sealed container.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+    using TestClass = tt::Singleton<>;
+
+    class Other {};
+
+    container.addType<Singleton<TestClass>>().seal();
+
+    auto any = container.getInstance(clonixin::tag::ptr, std::type_index(typeid(TestClass)));
+
+    cr_assert(bool(std::any_cast<std::shared_ptr<TestClass>>(any)), "Returned pointer should not be NULL.");
+    cr_assert_throw(
+            container.getInstance(clonixin::tag::ptr, std::type_index(typeid(Other)));
+    , ContainerException<ContainerError::TypeNotFound>);
+}
+
+Test(ContainerSealed, registerAfterSeal, .description = "Every add function is rejected once the container is sealed.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::builders;
+    using namespace clonixin::exceptions;
+    using namespace clonixin::tag::duplicate;
+    using Error = ContainerError;
+
+    class Empty {};
+
+    container.seal();
+
+    cr_assert_throw(container.addType<Transient<Empty>>(), ContainerException<Error::Sealed>);
+    cr_assert_throw(container.addType<Singleton<Empty>>(ignore), ContainerException<Error::Sealed>);
+    cr_assert_throw(container.addTransient(std::make_unique<GenericBuilder<Empty>>()), ContainerException<Error::Sealed>);
+    cr_assert_throw(container.addSingleton(std::make_unique<GenericBuilder<Empty>>(), over), ContainerException<Error::Sealed>);
+    cr_assert_throw(container.addInstance(std::make_unique<Empty>()), ContainerException<Error::Sealed>);
+    cr_assert_throw(
+            container.getInstance<Empty>();
+    , ContainerException<Error::TypeNotFound>);
+}
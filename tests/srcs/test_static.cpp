@@ -0,0 +1,90 @@
+#include <criterion/criterion.h>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+TestSuite(StaticContainer, .description = "Testing the compile-time container.", .disabled = false);
+
+Test(StaticContainer, getTransientWithDependencies, .description = "Build transients with transient dependencies.", .disabled = false) {
+    class Empty {};
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Transient<std::shared_ptr<Empty>>;
+    using TestClass = tt::Transient<std::shared_ptr<Dependency>>;
+
+    clonixin::StaticContainer<
+        Transient<Empty>,
+        With<Transient<Dependency>, Empty>,
+        With<Transient<TestClass>, Dependency>
+    > container;
+
+    std::shared_ptr<TestClass> ptr = container.get<TestClass>();
+    std::shared_ptr<TestClass> ptr2 = container.get<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert_not(ptr == ptr2, "Returned pointers should refer to different objects.");
+    cr_assert_eq(Dependency::getCount(), 2, "Dependency should be built exactly two times. Built %d time(s)", Dependency::getCount());
+    cr_assert_eq(TestClass::getCount(), 2, "TestClass should be built exactly two times. Built %d time(s)", TestClass::getCount());
+}
+
+Test(StaticContainer, getSingletonWithMixedDependencies, .description = "Singletons are built once per container.", .disabled = false) {
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Transient<>;
+    using Dependency2 = tt::Singleton<std::shared_ptr<Dependency>>;
+    using TestClass = tt::Transient<std::shared_ptr<Dependency>, std::shared_ptr<Dependency2>>;
+
+    clonixin::StaticContainer<
+        Transient<Dependency>,
+        With<Singleton<Dependency2>, Dependency>,
+        With<Transient<TestClass>, Dependency, Dependency2>
+    > container;
+
+    auto ptr = container.get<TestClass>();
+    auto ptr2 = container.get<TestClass>();
+
+    cr_assert_not(ptr == ptr2, "Returned pointers should not be equals.");
+    cr_assert(container.get<Dependency2>() == container.get<Dependency2>(), "Singleton pointers should be equals.");
+    cr_assert_eq(Dependency::getCount(), 3, "Dependency should be built exactly three times. Built %d time(s)", Dependency::getCount());
+    cr_assert_eq(Dependency2::getCount(), 1, "Dependency2 should be built exactly once. Built %d time(s)", Dependency2::getCount());
+}
+
+Test(StaticContainer, getInterface, .description = "Resolve a polymorphic registration.", .disabled = false) {
+    class TestClass: public tt::Interface<0> {
+        public:
+            TestClass(int i): _i(i) {}
+            int getDiscr() const override { return _i; }
+        private:
+            int _i;
+    };
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::utils::value;
+
+    clonixin::StaticContainer<
+        With<Singleton<tt::Interface<0>, TestClass>, Int<42>>
+    > container;
+
+    std::shared_ptr<tt::Interface<0>> ptr = container.get<tt::Interface<0>>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert_eq(ptr->getDiscr(), 42, "Direct value was not passed to the constructor.");
+}
+
+Test(StaticContainer, getByValue, .description = "Retrieve transients by value, including unmovable ones.", .disabled = false) {
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Transient<>;
+    using TestClass = tt::UnMovableTransient<Dependency &&>;
+
+    clonixin::StaticContainer<
+        Transient<Dependency>,
+        With<Transient<TestClass>, Dependency &&>
+    > container;
+
+    TestClass val = container.get<TestClass &&>();
+
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
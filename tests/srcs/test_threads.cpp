@@ -0,0 +1,155 @@
+#include <criterion/criterion.h>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace {
+    std::atomic<int> built;
+
+    struct Slow {
+        Slow() {
+            ++built;
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        }
+    };
+
+    struct A {};
+    struct B {};
+
+    template <int N>
+    struct Plugin {};
+
+    template <int... Ns>
+    void addPlugins(clonixin::Container &c, std::integer_sequence<int, Ns...>) {
+        using namespace clonixin::type_desc;
+
+        (c.addType<Singleton<Plugin<Ns>>>(), ...);
+    }
+}
+
+TestSuite(ContainerThreads, .description = "Testing concurrent resolutions.", .disabled = false);
+
+Test(ContainerThreads, singletonBuiltOnce, .description = "A singleton requested from several threads at once is built exactly once.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    built = 0;
+    container.addType<Singleton<Slow>>();
+
+    std::vector<std::shared_ptr<Slow>> ptrs(8);
+    std::vector<std::thread> threads;
+
+    for (auto &p: ptrs)
+        threads.emplace_back([&container, &p]() { p = container.getInstance<Slow>(); });
+    for (auto &t: threads)
+        t.join();
+
+    cr_assert_eq(built.load(), 1, "Slow should be built exactly once. Built %d time(s)", built.load());
+    for (auto &p: ptrs)
+        cr_assert(p == ptrs[0], "Returned pointers should be equals.");
+}
+
+Test(ContainerThreads, selfDependency, .description = "A singleton requesting itself while being built throws instead of hanging.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+    using namespace clonixin::exceptions;
+
+    auto buildA = [](clonixin::Container const &c, bool) -> std::any {
+        c.getInstance<A>();
+        return std::make_shared<A>();
+    };
+
+    container.addSingleton(std::make_unique<LambdaBuilder<decltype(buildA)>>(typeid(A), buildA));
+
+    cr_assert_throw(container.getInstance<A>(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerThreads, crossThreadDeadlock, .description = "Two singletons needing each other, built from two threads, throw instead of hanging.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::builders;
+    using namespace clonixin::exceptions;
+
+    std::atomic<int> started = 0;
+    auto wait_both = [&started]() {
+        ++started;
+        while (started.load() < 2)
+            std::this_thread::yield();
+    };
+
+    auto buildA = [&wait_both](clonixin::Container const &c, bool) -> std::any {
+        wait_both();
+        c.getInstance<B>();
+        return std::make_shared<A>();
+    };
+    auto buildB = [&wait_both](clonixin::Container const &c, bool) -> std::any {
+        wait_both();
+        c.getInstance<A>();
+        return std::make_shared<B>();
+    };
+
+    container
+        .addSingleton(std::make_unique<LambdaBuilder<decltype(buildA)>>(typeid(A), buildA))
+        .addSingleton(std::make_unique<LambdaBuilder<decltype(buildB)>>(typeid(B), buildB))
+    ;
+
+    std::atomic<int> deadlocks = 0;
+    auto run = [&deadlocks](auto fun) {
+        try {
+            fun();
+        } catch (ContainerException<ContainerError::Deadlock> const &) {
+            ++deadlocks;
+        } catch (ContainerException<ContainerError::CircularDependency> const &) {
+        }
+    };
+
+    std::thread ta(run, [&container]() { container.getInstance<A>(); });
+    std::thread tb(run, [&container]() { container.getInstance<B>(); });
+    ta.join();
+    tb.join();
+
+    cr_assert(deadlocks.load() > 0, "At least one thread should detect the deadlock.");
+}
+
+Test(ContainerThreads, registerWhileResolving, .description = "Types can be registered while other threads request instances.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    container
+        .addType<Transient<A>>()
+        .addType<Singleton<B>>()
+    ;
+
+    std::atomic<bool> done = false;
+    std::atomic<int> failures = 0;
+    std::vector<std::thread> readers;
+
+    for (int i = 0; i < 4; ++i)
+        readers.emplace_back([&container, &done, &failures]() {
+            auto b = container.getInstance<B>();
+
+            while (!done.load()) {
+                if (!container.getInstance<A>() || container.getInstance<B>() != b)
+                    ++failures;
+            }
+        });
+
+    for (int i = 0; i < 16; ++i) {
+        addPlugins(container, std::make_integer_sequence<int, 32>{});
+        container.addType<Transient<A>>();
+    }
+    done = true;
+    for (auto &t: readers)
+        t.join();
+
+    cr_assert_eq(failures.load(), 0, "Resolutions should not fail while registering. Failed %d time(s)", failures.load());
+    cr_assert(bool(container.getInstance<Plugin<31>>()), "Returned pointer should not be NULL.");
+}
@@ -0,0 +1,74 @@
+#include <criterion/criterion.h>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+TestSuite(ContainerTypeId, .description = "Testing dense type identifiers, and type-erased retrieval.", .disabled = false);
+
+Test(ContainerTypeId, stableIds, .description = "Ids are stable, distinct, and agree with std::type_index.", .disabled = false) {
+    using clonixin::utils::typeId;
+
+    class A {};
+    class B {};
+
+    cr_assert_eq(typeId<A>(), typeId<A>(), "Id of a type should not change.");
+    cr_assert_neq(typeId<A>(), typeId<B>(), "Different types should have different ids.");
+    cr_assert_eq(typeId<A>(), typeId(typeid(A)), "Id should not depend on how it is requested.");
+    cr_assert_eq(typeId<A const &>(), typeId<A>(), "References and cv-qualifiers should be ignored.");
+    cr_assert_eq(typeId<A &&>(), typeId<A>(), "References and cv-qualifiers should be ignored.");
+}
+
+Test(ContainerTypeId, getByTypeIndex, .description = "Retrieve instances through the type-erased interface.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Singleton<TestClass>>();
+
+    auto any = container.getInstance(clonixin::tag::ptr, std::type_index(typeid(TestClass)));
+    auto ptr = std::any_cast<std::shared_ptr<TestClass>>(any);
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr == container.getInstance<TestClass>(), "Returned pointers should be equals.");
+    cr_assert_eq(TestClass::getCount(), 1, "More than one instance of TestClass was built.");
+}
+
+Test(ContainerTypeId, getUnknownTypeIndex, .description = "Retrieve a type that never got an id through the type-erased interface.", .disabled = false) {
+    clonixin::Container container;
+    using namespace clonixin::exceptions;
+
+    struct NeverSeen {};
+
+    cr_assert_throw(
+            container.getInstance(clonixin::tag::ptr, std::type_index(typeid(NeverSeen)));
+    , ContainerException<ContainerError::TypeNotFound>);
+}
+
+Test(ContainerTypeId, tableLookupKeepsValues, .description = "Looking up an existing key does not grow the table.", .disabled = false) {
+    using clonixin::utils::_internals::TypeTable;
+
+    class A {};
+    class B {};
+    class C {};
+    class D {};
+
+    TypeTable<int> table;
+
+    // Four entries fill the first eight slots up to the growth threshold.
+    *table.tryEmplace(typeid(A)).first = 1;
+    table.tryEmplace(typeid(B));
+    table.tryEmplace(typeid(C));
+    table.tryEmplace(typeid(D));
+
+    int *value = table.find(typeid(A));
+    auto [found, inserted] = table.tryEmplace(typeid(A));
+
+    cr_assert_not(inserted, "An existing key should not be inserted again.");
+    cr_assert(found == value, "Looking up an existing key should not move its value.");
+    cr_assert_eq(*found, 1, "The stored value should be kept.");
+    cr_assert_eq(table.size(), 4, "The table should still hold four entries, not %zu.", table.size());
+}
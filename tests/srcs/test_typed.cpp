@@ -0,0 +1,72 @@
+#include <criterion/criterion.h>
+
+#include <any>
+#include <memory>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+#include "builders/LambdaBuilder.hpp"
+
+namespace tt = tests::types;
+
+TestSuite(ContainerTyped, .description = "Testing typed resolution, without std::any.", .disabled = false);
+
+Test(ContainerTyped, singletonSharedWithAny, .description = "Typed and type-erased requests share the singleton.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using TestClass = tt::Singleton<>;
+
+    container.addType<Singleton<TestClass>>();
+
+    auto erased = std::any_cast<std::shared_ptr<TestClass>>(container.getInstance(clonixin::tag::container::ptr, typeid(TestClass)));
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+
+    cr_assert(ptr == erased, "Returned pointers should be equals.");
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+}
+
+Test(ContainerTyped, polymorphicSingleton, .description = "Typed singletons are returned through their interface.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+
+    class TestClass: public tt::Interface<0> {
+        public:
+            int getDiscr() const override { return 42; }
+    };
+
+    container.addType<Singleton<tt::Interface<0>, TestClass>>();
+
+    std::shared_ptr<tt::Interface<0>> ptr = container.getInstance<tt::Interface<0>>();
+
+    cr_assert(ptr == container.getInstance<tt::Interface<0>>(), "Returned pointers should be equals.");
+    cr_assert_eq(ptr->getDiscr(), 42, "Returned instance should be usable.");
+}
+
+Test(ContainerTyped, instance, .description = "Instances added with addInstance are returned as is.", .disabled = false) {
+    clonixin::Container container;
+
+    auto obj = std::make_unique<tt::Singleton<>>();
+    auto *raw = obj.get();
+
+    container.addInstance(std::move(obj));
+
+    cr_assert(container.getInstance<tt::Singleton<>>().get() == raw, "Returned pointer should be the registered instance.");
+}
+
+Test(ContainerTyped, untypedSingleton, .description = "Singletons with a custom builder go through std::any.", .disabled = false) {
+    clonixin::Container container;
+
+    using TestClass = tt::Singleton<int>;
+
+    auto lambda = [](clonixin::Container const &, bool) -> std::any { return std::make_shared<TestClass>(42); };
+
+    container.addSingleton(std::make_unique<clonixin::builders::LambdaBuilder<decltype(lambda)>>(typeid(TestClass), lambda));
+
+    std::shared_ptr<TestClass> ptr = container.getInstance<TestClass>();
+
+    cr_assert(bool(ptr), "Returned pointer should not be NULL.");
+    cr_assert(ptr == container.getInstance<TestClass>(), "Returned pointers should be equals.");
+}
@@ -0,0 +1,208 @@
+#include <criterion/criterion.h>
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <typeindex>
+#include <vector>
+
+#include "./test_types.hpp"
+
+#include "container.hpp"
+
+namespace tt = tests::types;
+
+namespace {
+    struct CycleB;
+
+    struct CycleA {
+        CycleA(std::shared_ptr<CycleB>) {}
+    };
+
+    struct CycleB {
+        CycleB(std::shared_ptr<CycleA>) {}
+    };
+
+    struct Root {
+        Root() { ++count; }
+
+        static inline int count = 0;
+    };
+
+    struct Dependent {
+        Dependent(std::shared_ptr<Root>) { ++count; }
+
+        static inline int count = 0;
+    };
+
+    template <int N>
+    class Member: public tt::Interface<0> {
+        public:
+            Member() { ++count; }
+            int getDiscr() const override { return N; }
+
+            static inline int count = 0;
+    };
+
+    clonixin::WarmUpTiming const *timingOf(std::vector<clonixin::WarmUpTiming> const &timings, std::type_index t) {
+        auto it = std::find_if(timings.begin(), timings.end(), [t](auto const &timing) { return timing.type == t; });
+
+        return it == timings.end() ? nullptr : &*it;
+    }
+}
+
+TestSuite(ContainerWarmUp, .description = "Testing singleton warm-up.", .disabled = false);
+
+Test(ContainerWarmUp, warmUpBuildsSingletons, .description = "Warming up builds every singleton once, dependencies first.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Singleton<>;
+    using TestClass = tt::Singleton<std::shared_ptr<Dependency>>;
+    using Other = tt::Singleton<int>;
+    using clonixin::utils::value::Int;
+
+    container
+        .addType<Singleton<TestClass>, Dependency>()
+        .addType<Singleton<Dependency>>()
+        .addType<Singleton<Other>, Int<42>>()
+    ;
+
+    auto timings = container.warmUp();
+
+    cr_assert_eq(timings.size(), 3, "Three singletons should be built. Built %zu.", timings.size());
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should be built exactly once. Built %d time(s)", TestClass::getCount());
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+    cr_assert_eq(Other::getCount(), 1, "Other should be built exactly once. Built %d time(s)", Other::getCount());
+
+    auto const *test = timingOf(timings, typeid(TestClass));
+    auto const *dep = timingOf(timings, typeid(Dependency));
+
+    cr_assert(test && dep, "Every singleton should be timed.");
+    cr_assert(dep->start + dep->duration <= test->start, "Dependency should be built before TestClass.");
+
+    container.getInstance<TestClass>();
+    cr_assert_eq(TestClass::getCount(), 1, "TestClass should not be built again.");
+    cr_assert(container.warmUp().empty(), "Warming up twice should not build anything.");
+}
+
+Test(ContainerWarmUp, warmUpThroughTransient, .description = "Dependencies of transients are built before the singletons using them.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Singleton<>;
+    using Middle = tt::Transient<std::shared_ptr<Dependency>>;
+    using TestClass = tt::Singleton<std::shared_ptr<Middle>>;
+
+    container
+        .addType<Singleton<TestClass>, Middle>()
+        .addType<Transient<Middle>, Dependency>()
+        .addType<Singleton<Dependency>>()
+    ;
+
+    auto timings = container.warmUp();
+
+    auto const *test = timingOf(timings, typeid(TestClass));
+    auto const *dep = timingOf(timings, typeid(Dependency));
+
+    cr_assert_eq(timings.size(), 2, "Two singletons should be built. Built %zu.", timings.size());
+    cr_assert(test && dep, "Every singleton should be timed.");
+    cr_assert(dep->start + dep->duration <= test->start, "Dependency should be built before TestClass.");
+}
+
+Test(ContainerWarmUp, warmUpOnThreads, .description = "Warm-up tasks can run on other threads.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using Dependency = tt::Singleton<>;
+    using TestClass = tt::Singleton<std::shared_ptr<Dependency>>;
+    using Other = tt::Singleton<std::shared_ptr<Dependency>, int>;
+    using clonixin::utils::value::Int;
+
+    container
+        .addType<Singleton<TestClass>, Dependency>()
+        .addType<Singleton<Other>, Dependency, Int<42>>()
+        .addType<Singleton<Dependency>>()
+    ;
+
+    std::mutex mutex;
+    std::vector<std::thread> threads;
+
+    auto timings = container.warmUp([&mutex, &threads](std::function<void()> task) {
+        std::lock_guard lock(mutex);
+        threads.emplace_back(std::move(task));
+    });
+
+    for (auto &t: threads)
+        t.join();
+
+    cr_assert_eq(timings.size(), 3, "Three singletons should be built. Built %zu.", timings.size());
+    cr_assert_eq(threads.size(), 3, "Each singleton should be built by a task.");
+    cr_assert_eq(Dependency::getCount(), 1, "Dependency should be built exactly once. Built %d time(s)", Dependency::getCount());
+}
+
+Test(ContainerWarmUp, warmUpCycle, .description = "Warming up a dependency cycle throws instead of hanging.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using namespace clonixin::exceptions;
+
+    container
+        .addType<Singleton<CycleA>, CycleB>()
+        .addType<Singleton<CycleB>, CycleA>()
+    ;
+
+    cr_assert_throw(container.warmUp(), ContainerException<ContainerError::CircularDependency>, "Should throw a CircularDependency exception.");
+}
+
+Test(ContainerWarmUp, warmUpInlineOrder, .description = "Running tasks inline submits each singleton once, whatever their order.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    using clonixin::utils::typeId;
+
+    // Root gets the lower id, so its dependent comes later in the node list.
+    (void)typeId<Root>();
+    (void)typeId<Dependent>();
+
+    container
+        .addType<Singleton<Dependent>, Root>()
+        .addType<Singleton<Root>>()
+    ;
+
+    int submitted = 0;
+    auto timings = container.warmUp([&submitted](std::function<void()> const &task) {
+        cr_assert(++submitted <= 2, "A singleton should not be submitted twice.");
+        task();
+    });
+
+    cr_assert_eq(submitted, 2, "Each singleton should be submitted once. Submitted %d task(s)", submitted);
+    cr_assert_eq(timings.size(), 2, "Two singletons should be built. Built %zu.", timings.size());
+    cr_assert_eq(Root::count, 1, "Root should be built exactly once. Built %d time(s)", Root::count);
+    cr_assert_eq(Dependent::count, 1, "Dependent should be built exactly once. Built %d time(s)", Dependent::count);
+}
+
+Test(ContainerWarmUp, warmUpCollection, .description = "Every singleton of a collection is built, not only the last one.", .disabled = false) {
+    clonixin::Container container;
+
+    using namespace clonixin::type_desc;
+    namespace dup = clonixin::tag::container::duplicate;
+
+    container
+        .addType<Singleton<tt::Interface<0>, Member<1>>>(dup::append)
+        .addType<Singleton<tt::Interface<0>, Member<2>>>(dup::append)
+    ;
+
+    auto timings = container.warmUp();
+
+    cr_assert_eq(timings.size(), 2, "Both members should be built. Built %zu.", timings.size());
+    cr_assert_eq(Member<1>::count, 1, "The first member should be built exactly once. Built %d time(s)", Member<1>::count);
+    cr_assert_eq(Member<2>::count, 1, "The second member should be built exactly once. Built %d time(s)", Member<2>::count);
+
+    auto all = container.getAll<tt::Interface<0>>();
+
+    cr_assert_eq(all.size(), 2, "Expected 2 instances, got %zu.", all.size());
+    cr_assert_eq(Member<1>::count + Member<2>::count, 2, "Members should not be built again.");
+    cr_assert(container.warmUp().empty(), "Warming up twice should not build anything.");
+}